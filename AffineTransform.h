@@ -0,0 +1,121 @@
+#pragma once
+
+namespace Space {
+
+/// An affine transformation from one space to another. Points are rotated,
+/// scaled and translated; vectors ignore the translation. An AffineTransform
+/// can also be used as a Transform Manager for conversions between its spaces.
+template <typename From, typename To> class AffineTransform final {
+    using _scalar = implementation::ScalarOf<From>;
+
+  public:
+    /// The identity transform.
+    AffineTransform() noexcept = default;
+
+    /// Creates a transform from a 3x4 matrix, given row by row. The last
+    /// column is the translation.
+    explicit AffineTransform(const std::array<std::array<double, 4>, 3>& rows) noexcept {
+        for (int row = 0; row < 3; ++row) {
+            for (int column = 0; column < 4; ++column) {
+                matrix(row, column) = rows[row][column];
+            }
+        }
+    }
+
+    explicit AffineTransform(const implementation::AffineMatrix& matrix) noexcept : matrix(matrix) {}
+
+    [[nodiscard]] double operator()(const int row, const int column) const noexcept { return matrix(row, column); }
+
+    [[nodiscard]] const implementation::AffineMatrix& Matrix() const noexcept { return matrix; }
+
+    /// Composes this transform with one that continues from its destination.
+    template <typename Next>
+    [[nodiscard]] AffineTransform<From, Next> operator*(const AffineTransform<To, Next>& next) const noexcept {
+        return AffineTransform<From, Next>(next.Matrix() * matrix);
+    }
+
+    [[nodiscard]] AffineTransform<To, From> Inverse() const { return AffineTransform<To, From>(matrix.Inverse()); }
+
+    template <typename UnderlyingData, implementation::BaseType BT>
+    [[nodiscard]] auto Apply(const implementation::Base<From, UnderlyingData, BT>& in) const noexcept {
+        using namespace implementation;
+        using _converted = std::conditional_t<IsPoint(BT), Point<To, UnderlyingData>, Vector<To, UnderlyingData>>;
+        _converted out;
+        matrix.Apply<IsPoint(BT)>(in.cbegin(), out.begin());
+        return out;
+    }
+
+    template <typename UnderlyingData>
+    void Apply(
+        const implementation::ConstPointSpan<From, UnderlyingData>& in,
+        const implementation::PointSpan<To, UnderlyingData>& out
+    ) const {
+        TransformPoints<From, To>(std::span<const UnderlyingData>(in.Underlying()), out.Underlying());
+    }
+
+    template <typename UnderlyingData>
+    void Apply(
+        const implementation::ConstVectorSpan<From, UnderlyingData>& in,
+        const implementation::VectorSpan<To, UnderlyingData>& out
+    ) const {
+        TransformVectors<From, To>(std::span<const UnderlyingData>(in.Underlying()), out.Underlying());
+    }
+
+    template <std::same_as<From> F, std::same_as<To> T, typename UnderlyingData>
+    [[nodiscard]] UnderlyingData TransformPoint(const UnderlyingData& in) const noexcept {
+        UnderlyingData out = in;
+        matrix.Apply<true>(implementation::CBegin<_scalar>(in), implementation::Begin<_scalar>(out));
+        return out;
+    }
+
+    template <std::same_as<From> F, std::same_as<To> T, typename UnderlyingData>
+    [[nodiscard]] UnderlyingData TransformVector(const UnderlyingData& in) const noexcept {
+        UnderlyingData out = in;
+        matrix.Apply<false>(implementation::CBegin<_scalar>(in), implementation::Begin<_scalar>(out));
+        return out;
+    }
+
+    template <std::same_as<From> F, std::same_as<To> T, typename UnderlyingData>
+    void TransformPoints(std::span<const UnderlyingData> in, std::span<UnderlyingData> out) const {
+        Transform<true>(in, out);
+    }
+
+    template <std::same_as<From> F, std::same_as<To> T, typename UnderlyingData>
+    void TransformVectors(std::span<const UnderlyingData> in, std::span<UnderlyingData> out) const {
+        Transform<false>(in, out);
+    }
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+    template <implementation::DifferentSpaceTo<To> Other, typename Next>
+    StaticAssert::invalid_transform_composition operator*(const AffineTransform<Other, Next>&) const noexcept {
+        return StaticAssert::invalid_transform_composition{};
+    }
+
+    template <implementation::DifferentSpaceTo<From> OtherSpace, typename UnderlyingData, implementation::BaseType BT>
+    StaticAssert::invalid_space Apply(const implementation::Base<OtherSpace, UnderlyingData, BT>&) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+#endif
+
+  private:
+    template <bool Translate, typename UnderlyingData>
+    void Transform(std::span<const UnderlyingData> in, std::span<UnderlyingData> out) const {
+        if (in.size() != out.size()) {
+            throw std::invalid_argument("Spans must be the same size");
+        }
+        if (in.empty()) {
+            return;
+        }
+        implementation::ApplyAffine<Translate>(
+            matrix,
+            implementation::CBegin<_scalar>(in.front()),
+            implementation::Begin<_scalar>(out.front()),
+            in.size(),
+            sizeof(UnderlyingData)
+        );
+    }
+
+    implementation::AffineMatrix matrix;
+};
+
+} // namespace Space
@@ -0,0 +1,83 @@
+#pragma once
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+// Each benchmark applies one operation to every element of these inputs, and
+// is paired with a hand-written baseline doing the same work on TestVectors.
+constexpr std::size_t benchmarkSize = 1024;
+
+/// Stops the compiler from optimizing away a value that is otherwise unused.
+template <typename T> void KeepAlive(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile char* p = reinterpret_cast<const volatile char*>(&value);
+    static_cast<void>(*p);
+#endif
+}
+
+inline std::vector<TestVector> MakeRawInputs(const double seed) {
+    std::vector<TestVector> values(benchmarkSize);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const auto d = static_cast<double>(i);
+        values[i].m_values = {seed + d, seed - 2 * d, 1 + seed * d};
+    }
+    return values;
+}
+
+template <typename T> std::vector<T> MakeInputs(const double seed) {
+    std::vector<T> values;
+    for (const auto& raw : MakeRawInputs(seed)) {
+        values.emplace_back(raw);
+    }
+    return values;
+}
+
+template <typename Op> TestVector Raw(const TestVector& a, const TestVector& b, Op op) {
+    TestVector r;
+    r.m_values = {op(a.m_values[0], b.m_values[0]), op(a.m_values[1], b.m_values[1]), op(a.m_values[2], b.m_values[2])};
+    return r;
+}
+
+inline TestVector RawAdd(const TestVector& a, const TestVector& b) { return Raw(a, b, std::plus<>()); }
+inline TestVector RawSub(const TestVector& a, const TestVector& b) { return Raw(a, b, std::minus<>()); }
+
+inline TestVector RawScale(const TestVector& a, const double d) {
+    TestVector r;
+    r.m_values = {a.m_values[0] * d, a.m_values[1] * d, a.m_values[2] * d};
+    return r;
+}
+
+inline double RawDot(const TestVector& a, const TestVector& b) {
+    return a.m_values[0] * b.m_values[0] + a.m_values[1] * b.m_values[1] + a.m_values[2] * b.m_values[2];
+}
+
+inline TestVector RawCross(const TestVector& a, const TestVector& b) {
+    const auto& [ax, ay, az] = a.m_values;
+    const auto& [bx, by, bz] = b.m_values;
+    TestVector r;
+    r.m_values = {ay * bz - az * by, az * bx - ax * bz, ax * by - ay * bx};
+    return r;
+}
+
+inline double RawMag(const TestVector& a) { return std::sqrt(RawDot(a, a)); }
+
+inline TestVector RawNorm(const TestVector& a) {
+    const auto mag = RawMag(a);
+    if (mag < 1e-6) {
+        throw std::invalid_argument("Zero-sized normal vectors are not allowed");
+    }
+    return RawScale(a, 1 / mag);
+}
+
+inline bool RawEqual(const TestVector& a, const TestVector& b) {
+    return std::equal(a.m_values.begin(), a.m_values.end(), b.m_values.begin(), [](double x, double y) {
+        return std::abs(x - y) < 1e-6;
+    });
+}
+
+inline TestVector RawXY(const TestVector& a) {
+    TestVector r;
+    r.m_values = {a.m_values[0], a.m_values[1], 0};
+    return r;
+}
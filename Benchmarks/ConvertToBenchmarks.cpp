@@ -0,0 +1,60 @@
+#include "BenchmarkHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("ConvertTo benchmarks") {
+    const AffineTransform<View, Image> transform({{{0, -1, 0, 10}, {1, 0, 0, 20}, {0, 0, 1, 30}}});
+    const auto p = MakeInputs<View::Point>(1);
+    const auto v = MakeInputs<View::Vector>(2);
+    const auto rawP = MakeRawInputs(1);
+    const auto rawV = MakeRawInputs(2);
+
+    const auto rawTransform = [&transform](const TestVector& in, const bool translate) {
+        TestVector out;
+        for (int row = 0; row < 3; ++row) {
+            out.m_values[row] = transform(row, 0) * in.m_values[0] + transform(row, 1) * in.m_values[1] +
+                                transform(row, 2) * in.m_values[2] + (translate ? transform(row, 3) : 0.0);
+        }
+        return out;
+    };
+
+    BENCHMARK("Point ConvertTo") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i].ConvertTo<Image>(transform));
+        }
+    }
+    BENCHMARK("raw: Point ConvertTo") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(rawTransform(rawP[i], true));
+        }
+    }
+
+    BENCHMARK("Vector ConvertTo") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(v[i].ConvertTo<Image>(transform));
+        }
+    }
+    BENCHMARK("raw: Vector ConvertTo") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(rawTransform(rawV[i], false));
+        }
+    }
+
+    std::vector<Image::Point> converted(benchmarkSize);
+    std::vector<TestVector> rawConverted(benchmarkSize);
+
+    BENCHMARK("PointSpan ConvertTo") {
+        View::ConstPointSpan(p).ConvertTo<Image>(transform, Image::PointSpan(converted));
+        KeepAlive(converted.back());
+    }
+    BENCHMARK("raw: PointSpan ConvertTo") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            rawConverted[i] = rawTransform(rawP[i], true);
+        }
+        KeepAlive(rawConverted.back());
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
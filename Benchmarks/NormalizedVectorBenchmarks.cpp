@@ -0,0 +1,113 @@
+#include "BenchmarkHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("NormalizedVector benchmarks") {
+    const auto raw = MakeRawInputs(1);
+    const auto n = MakeInputs<Image::NormalizedVector>(1);
+    const auto m = MakeInputs<Image::NormalizedVector>(2);
+    const auto v = MakeInputs<Image::Vector>(3);
+    std::vector<TestVector> rawN;
+    std::vector<TestVector> rawM;
+    for (std::size_t i = 0; i < benchmarkSize; ++i) {
+        rawN.push_back(static_cast<TestVector>(n[i]));
+        rawM.push_back(static_cast<TestVector>(m[i]));
+    }
+    const auto rawV = MakeRawInputs(3);
+
+    BENCHMARK("NormalizedVector construction") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(Image::NormalizedVector(raw[i]));
+        }
+    }
+    BENCHMARK("raw: NormalizedVector construction") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawNorm(raw[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedVector + Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] + v[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedVector + Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawAdd(rawN[i], rawV[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedVector - Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] - v[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedVector - Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawSub(rawN[i], rawV[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedVector * double") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] * 1.5);
+        }
+    }
+    BENCHMARK("raw: NormalizedVector * double") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawScale(rawN[i], 1.5));
+        }
+    }
+
+    BENCHMARK("NormalizedVector * Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] * v[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedVector * Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawCross(rawN[i], rawV[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedVector * NormalizedVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] * m[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedVector * NormalizedVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawNorm(RawCross(rawN[i], rawM[i])));
+        }
+    }
+
+    BENCHMARK("NormalizedVector *= NormalizedVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            auto normal = n[i];
+            normal *= m[i];
+            KeepAlive(normal);
+        }
+    }
+    BENCHMARK("raw: NormalizedVector *= NormalizedVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            auto normal = rawN[i];
+            normal = RawNorm(RawCross(normal, rawM[i]));
+            KeepAlive(normal);
+        }
+    }
+
+    BENCHMARK("NormalizedVector Dot") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i].Dot(m[i]));
+        }
+    }
+    BENCHMARK("raw: NormalizedVector Dot") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawDot(rawN[i], rawM[i]));
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
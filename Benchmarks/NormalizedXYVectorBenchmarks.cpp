@@ -0,0 +1,149 @@
+#include "BenchmarkHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("NormalizedXYVector benchmarks") {
+    const auto raw = MakeRawInputs(1);
+    const auto n = MakeInputs<Image::NormalizedXYVector>(1);
+    const auto v = MakeInputs<Image::XYVector>(2);
+    const auto u = MakeInputs<Image::Vector>(3);
+    // At right angles to n, so that their cross products can always be normalized.
+    std::vector<Image::NormalizedXYVector> m;
+    for (const auto& normal : n) {
+        m.emplace_back(-normal.Y(), normal.X());
+    }
+    std::vector<TestVector> rawN;
+    std::vector<TestVector> rawM;
+    std::vector<TestVector> rawV;
+    for (std::size_t i = 0; i < benchmarkSize; ++i) {
+        rawN.push_back(static_cast<TestVector>(n[i]));
+        rawM.push_back(static_cast<TestVector>(m[i]));
+        rawV.push_back(static_cast<TestVector>(v[i]));
+    }
+    const auto rawU = MakeRawInputs(3);
+
+    BENCHMARK("NormalizedXYVector construction") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(Image::NormalizedXYVector(raw[i]));
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector construction") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawNorm(RawXY(raw[i])));
+        }
+    }
+
+    BENCHMARK("NormalizedXYVector + XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] + v[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector + XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawAdd(rawN[i], rawV[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedXYVector - XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] - v[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector - XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawSub(rawN[i], rawV[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedXYVector + Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] + u[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector + Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawAdd(rawN[i], rawU[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedXYVector - Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] - u[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector - Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawSub(rawN[i], rawU[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedXYVector * double") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] * 1.5);
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector * double") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawScale(rawN[i], 1.5));
+        }
+    }
+
+    BENCHMARK("NormalizedXYVector * XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] * v[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector * XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawCross(rawN[i], rawV[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedXYVector * NormalizedXYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] * m[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector * NormalizedXYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawNorm(RawCross(rawN[i], rawM[i])));
+        }
+    }
+
+    BENCHMARK("NormalizedXYVector Dot") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i].Dot(m[i]));
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector Dot") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawDot(rawN[i], rawM[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedXYVector == NormalizedXYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(n[i] == m[i]);
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector == NormalizedXYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawEqual(rawN[i], rawM[i]));
+        }
+    }
+
+    BENCHMARK("NormalizedXYVector to Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(static_cast<Image::Vector>(n[i]));
+        }
+    }
+    BENCHMARK("raw: NormalizedXYVector to Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawXY(rawN[i]));
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,117 @@
+#include "BenchmarkHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Point benchmarks") {
+    const auto p = MakeInputs<Image::Point>(1);
+    const auto q = MakeInputs<Image::Point>(3);
+    const auto v = MakeInputs<Image::Vector>(2);
+    const auto rawP = MakeRawInputs(1);
+    const auto rawQ = MakeRawInputs(3);
+    const auto rawV = MakeRawInputs(2);
+
+    BENCHMARK("Point + Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i] + v[i]);
+        }
+    }
+    BENCHMARK("raw: Point + Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawAdd(rawP[i], rawV[i]));
+        }
+    }
+
+    BENCHMARK("Point - Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i] - v[i]);
+        }
+    }
+    BENCHMARK("raw: Point - Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawSub(rawP[i], rawV[i]));
+        }
+    }
+
+    BENCHMARK("Point - Point") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i] - q[i]);
+        }
+    }
+    BENCHMARK("raw: Point - Point") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawSub(rawP[i], rawQ[i]));
+        }
+    }
+
+    BENCHMARK("Point += Vector") {
+        auto point = p[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            point += v[i];
+        }
+        KeepAlive(point);
+    }
+    BENCHMARK("raw: Point += Vector") {
+        auto point = rawP[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            point = RawAdd(point, rawV[i]);
+        }
+        KeepAlive(point);
+    }
+
+    BENCHMARK("Point -= Vector") {
+        auto point = p[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            point -= v[i];
+        }
+        KeepAlive(point);
+    }
+    BENCHMARK("raw: Point -= Vector") {
+        auto point = rawP[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            point = RawSub(point, rawV[i]);
+        }
+        KeepAlive(point);
+    }
+
+    BENCHMARK("Point == Point") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i] == q[i]);
+        }
+    }
+    BENCHMARK("raw: Point == Point") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawEqual(rawP[i], rawQ[i]));
+        }
+    }
+
+    BENCHMARK("Point operator[]") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i][0] + p[i][1] * p[i][2]);
+        }
+    }
+    BENCHMARK("Point at<I>()") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i].at<0>() + p[i].at<1>() * p[i].at<2>());
+        }
+    }
+    BENCHMARK("raw: Point element access") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(rawP[i].m_values[0] + rawP[i].m_values[1] * rawP[i].m_values[2]);
+        }
+    }
+
+    BENCHMARK("Point operator[] with a run-time index") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i][i % 3]);
+        }
+    }
+    BENCHMARK("raw: Point element access with a run-time index") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(rawP[i].m_values[i % 3]);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
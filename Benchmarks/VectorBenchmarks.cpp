@@ -0,0 +1,173 @@
+#include "BenchmarkHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Vector benchmarks") {
+    const auto a = MakeInputs<Image::Vector>(1);
+    const auto b = MakeInputs<Image::Vector>(2);
+    const auto rawA = MakeRawInputs(1);
+    const auto rawB = MakeRawInputs(2);
+
+    BENCHMARK("Vector + Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(a[i] + b[i]);
+        }
+    }
+    BENCHMARK("raw: Vector + Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawAdd(rawA[i], rawB[i]));
+        }
+    }
+
+    BENCHMARK("Vector - Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(a[i] - b[i]);
+        }
+    }
+    BENCHMARK("raw: Vector - Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawSub(rawA[i], rawB[i]));
+        }
+    }
+
+    BENCHMARK("Vector += Vector") {
+        auto v = a[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            v += b[i];
+        }
+        KeepAlive(v);
+    }
+    BENCHMARK("raw: Vector += Vector") {
+        auto v = rawA[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            v = RawAdd(v, rawB[i]);
+        }
+        KeepAlive(v);
+    }
+
+    BENCHMARK("Vector -= Vector") {
+        auto v = a[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            v -= b[i];
+        }
+        KeepAlive(v);
+    }
+    BENCHMARK("raw: Vector -= Vector") {
+        auto v = rawA[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            v = RawSub(v, rawB[i]);
+        }
+        KeepAlive(v);
+    }
+
+    BENCHMARK("Vector * double") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(a[i] * 1.5);
+        }
+    }
+    BENCHMARK("raw: Vector * double") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawScale(rawA[i], 1.5));
+        }
+    }
+
+    BENCHMARK("Vector *= double") {
+        auto v = a[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            v *= 0.999;
+        }
+        KeepAlive(v);
+    }
+    BENCHMARK("raw: Vector *= double") {
+        auto v = rawA[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            v = RawScale(v, 0.999);
+        }
+        KeepAlive(v);
+    }
+
+    BENCHMARK("Vector * Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(a[i] * b[i]);
+        }
+    }
+    BENCHMARK("raw: Vector * Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawCross(rawA[i], rawB[i]));
+        }
+    }
+
+    BENCHMARK("Vector *= Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            auto v = a[i];
+            v *= b[i];
+            KeepAlive(v);
+        }
+    }
+    BENCHMARK("raw: Vector *= Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            auto v = rawA[i];
+            v = RawCross(v, rawB[i]);
+            KeepAlive(v);
+        }
+    }
+
+    BENCHMARK("Vector Dot") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(a[i].Dot(b[i]));
+        }
+    }
+    BENCHMARK("raw: Vector Dot") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawDot(rawA[i], rawB[i]));
+        }
+    }
+
+    BENCHMARK("Vector Mag") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(a[i].Mag_double());
+        }
+    }
+    BENCHMARK("raw: Vector Mag") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawMag(rawA[i]));
+        }
+    }
+
+    BENCHMARK("Vector Norm") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(a[i].Norm());
+        }
+    }
+    BENCHMARK("raw: Vector Norm") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawNorm(rawA[i]));
+        }
+    }
+
+    BENCHMARK("Vector ToXY") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(a[i].ToXY());
+        }
+    }
+    BENCHMARK("raw: Vector ToXY") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawXY(rawA[i]));
+        }
+    }
+
+    BENCHMARK("Vector == Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(a[i] == b[i]);
+        }
+    }
+    BENCHMARK("raw: Vector == Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawEqual(rawA[i], rawB[i]));
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
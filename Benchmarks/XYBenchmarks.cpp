@@ -0,0 +1,220 @@
+#include "BenchmarkHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("XY benchmarks") {
+    const auto p = MakeInputs<Image::XYPoint>(1);
+    const auto q = MakeInputs<Image::XYPoint>(4);
+    const auto v = MakeInputs<Image::XYVector>(2);
+    const auto w = MakeInputs<Image::XYVector>(3);
+    std::vector<TestVector> rawP;
+    std::vector<TestVector> rawQ;
+    std::vector<TestVector> rawV;
+    std::vector<TestVector> rawW;
+    for (std::size_t i = 0; i < benchmarkSize; ++i) {
+        rawP.push_back(static_cast<TestVector>(p[i]));
+        rawQ.push_back(static_cast<TestVector>(q[i]));
+        rawV.push_back(static_cast<TestVector>(v[i]));
+        rawW.push_back(static_cast<TestVector>(w[i]));
+    }
+
+    BENCHMARK("XYPoint + XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i] + v[i]);
+        }
+    }
+    BENCHMARK("raw: XYPoint + XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawAdd(rawP[i], rawV[i]));
+        }
+    }
+
+    BENCHMARK("XYPoint - XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i] - v[i]);
+        }
+    }
+    BENCHMARK("raw: XYPoint - XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawSub(rawP[i], rawV[i]));
+        }
+    }
+
+    BENCHMARK("XYPoint - XYPoint") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(p[i] - q[i]);
+        }
+    }
+    BENCHMARK("raw: XYPoint - XYPoint") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawSub(rawP[i], rawQ[i]));
+        }
+    }
+
+    BENCHMARK("XYPoint += XYVector") {
+        auto point = p[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            point += v[i];
+        }
+        KeepAlive(point);
+    }
+    BENCHMARK("raw: XYPoint += XYVector") {
+        auto point = rawP[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            point = RawAdd(point, rawV[i]);
+        }
+        KeepAlive(point);
+    }
+
+    BENCHMARK("XYPoint -= XYVector") {
+        auto point = p[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            point -= v[i];
+        }
+        KeepAlive(point);
+    }
+    BENCHMARK("raw: XYPoint -= XYVector") {
+        auto point = rawP[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            point = RawSub(point, rawV[i]);
+        }
+        KeepAlive(point);
+    }
+
+    BENCHMARK("XYVector + XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(v[i] + w[i]);
+        }
+    }
+    BENCHMARK("raw: XYVector + XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawAdd(rawV[i], rawW[i]));
+        }
+    }
+
+    BENCHMARK("XYVector - XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(v[i] - w[i]);
+        }
+    }
+    BENCHMARK("raw: XYVector - XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawSub(rawV[i], rawW[i]));
+        }
+    }
+
+    BENCHMARK("XYVector += XYVector") {
+        auto vector = v[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            vector += w[i];
+        }
+        KeepAlive(vector);
+    }
+    BENCHMARK("raw: XYVector += XYVector") {
+        auto vector = rawV[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            vector = RawAdd(vector, rawW[i]);
+        }
+        KeepAlive(vector);
+    }
+
+    BENCHMARK("XYVector -= XYVector") {
+        auto vector = v[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            vector -= w[i];
+        }
+        KeepAlive(vector);
+    }
+    BENCHMARK("raw: XYVector -= XYVector") {
+        auto vector = rawV[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            vector = RawSub(vector, rawW[i]);
+        }
+        KeepAlive(vector);
+    }
+
+    BENCHMARK("XYVector * double") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(v[i] * 1.5);
+        }
+    }
+    BENCHMARK("raw: XYVector * double") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawScale(rawV[i], 1.5));
+        }
+    }
+
+    BENCHMARK("XYVector *= double") {
+        auto vector = v[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            vector *= 0.999;
+        }
+        KeepAlive(vector);
+    }
+    BENCHMARK("raw: XYVector *= double") {
+        auto vector = rawV[0];
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            vector = RawScale(vector, 0.999);
+        }
+        KeepAlive(vector);
+    }
+
+    BENCHMARK("XYVector * XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(v[i] * w[i]);
+        }
+    }
+    BENCHMARK("raw: XYVector * XYVector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawCross(rawV[i], rawW[i]));
+        }
+    }
+
+    BENCHMARK("XYVector Dot") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(v[i].Dot(w[i]));
+        }
+    }
+    BENCHMARK("raw: XYVector Dot") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawDot(rawV[i], rawW[i]));
+        }
+    }
+
+    BENCHMARK("XYVector Mag") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(v[i].Mag_double());
+        }
+    }
+    BENCHMARK("raw: XYVector Mag") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawMag(rawV[i]));
+        }
+    }
+
+    BENCHMARK("XYVector Norm") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(v[i].Norm());
+        }
+    }
+    BENCHMARK("raw: XYVector Norm") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawNorm(rawV[i]));
+        }
+    }
+
+    BENCHMARK("XYVector to Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(static_cast<Image::Vector>(v[i]));
+        }
+    }
+    BENCHMARK("raw: XYVector to Vector") {
+        for (std::size_t i = 0; i < benchmarkSize; ++i) {
+            KeepAlive(RawXY(rawV[i]));
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
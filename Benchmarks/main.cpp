@@ -0,0 +1,30 @@
+#define CATCH_CONFIG_MAIN
+#include "BenchmarkHelpers.h"
+
+namespace {
+
+// Reports each benchmark as a line of comma-separated values, so that results
+// can be compared between runs. Use it with: space_bench -r csv
+struct CsvReporter final : Catch::StreamingReporterBase<CsvReporter> {
+    using StreamingReporterBase::StreamingReporterBase;
+
+    static std::string getDescription() { return "Reports benchmark timings as comma-separated values"; }
+
+    void testRunStarting(Catch::TestRunInfo const& info) override {
+        StreamingReporterBase::testRunStarting(info);
+        stream << "name,iterations,elapsed_ns,ns_per_iteration\n";
+    }
+
+    void benchmarkEnded(Catch::BenchmarkStats const& stats) override {
+        const auto perIteration = static_cast<double>(stats.elapsedTimeInNanoseconds) / static_cast<double>(stats.iterations);
+        stream << '"' << stats.info.name << "\"," << stats.iterations << ',' << stats.elapsedTimeInNanoseconds << ','
+               << perIteration << '\n';
+    }
+
+    void assertionStarting(Catch::AssertionInfo const&) override {}
+    bool assertionEnded(Catch::AssertionStats const&) override { return true; }
+};
+
+} // namespace
+
+CATCH_REGISTER_REPORTER("csv", CsvReporter)
@@ -0,0 +1,169 @@
+#pragma once
+
+namespace Space {
+
+/// The 64 bytes at the start of binary point data. It records what the
+/// coordinates after it hold, so that they can only be read back as the same
+/// type in the same space. The coordinates follow in native byte order, with
+/// two per element for XY types and three otherwise.
+struct BinaryHeader final {
+    std::array<char, 4> magic{'S', 'P', 'T', 'B'};
+    std::uint8_t version = 1;
+    std::uint8_t baseType = 0;
+    std::uint8_t scalarSize = 0;
+    std::uint8_t littleEndian = std::endian::native == std::endian::little;
+    std::uint64_t count = 0;
+    std::array<char, 48> space{};
+};
+static_assert(sizeof(BinaryHeader) == 64, "The binary header must stay 64 bytes.");
+
+namespace implementation {
+
+template <typename T> using SpaceOfElement = decltype(SpaceTypeOf(std::declval<const T&>()));
+template <typename T> constexpr BaseType BaseTypeOfElement = decltype(BaseTypeOf(std::declval<const T&>()))::value;
+
+/// Elements whose underlying data is exactly three scalars are read and
+/// written as one block of memory.
+template <typename T> concept PackedElement = Is3D(BaseTypeOfElement<T>) && requires(const Span<T>& span) { span.Scalars(); };
+
+template <typename T> [[nodiscard]] BinaryHeader MakeHeader(const std::size_t count) {
+    const std::string_view name = SpaceTypeNameMap<SpaceOfElement<T>>::name;
+    BinaryHeader header;
+    if (name.size() > header.space.size()) {
+        throw std::invalid_argument("The space name is too long for the binary format");
+    }
+    header.baseType = static_cast<std::uint8_t>(BaseTypeOfElement<T>);
+    header.scalarSize = sizeof(typename T::Scalar);
+    header.count = count;
+    std::copy(name.begin(), name.end(), header.space.begin());
+    return header;
+}
+
+template <typename T> void CheckHeader(const BinaryHeader& header) {
+    const BinaryHeader expected = MakeHeader<T>(header.count);
+    if (header.magic != expected.magic || header.version != expected.version) {
+        throw std::invalid_argument("The data is not in the binary point format");
+    }
+    if (header.space != expected.space) {
+        throw std::invalid_argument("The data belongs to a different space");
+    }
+    if (header.baseType != expected.baseType) {
+        throw std::invalid_argument("The data holds a different type of point or vector");
+    }
+    if (header.scalarSize != expected.scalarSize) {
+        throw std::invalid_argument("The data has a different scalar type");
+    }
+    if (header.littleEndian != expected.littleEndian) {
+        throw std::invalid_argument("The data was written with a different byte order");
+    }
+}
+
+template <typename T> void WriteCoordinates(std::ostream& os, const std::span<const T> elements) {
+    using Scalar = typename T::Scalar;
+    if constexpr (PackedElement<const T>) {
+        const auto scalars = Span<const T>(elements).Scalars();
+        const auto bytes = static_cast<std::streamsize>(scalars.size_bytes());
+        os.write(reinterpret_cast<const char*>(scalars.data()), bytes);
+    } else {
+        // Other layouts are gathered a block at a time.
+        constexpr std::size_t dimensions = Dimensions(BaseTypeOfElement<T>);
+        constexpr std::size_t blockSize = 256;
+        std::array<Scalar, blockSize * dimensions> block;
+        for (std::size_t first = 0; first < elements.size(); first += blockSize) {
+            const auto count = std::min(blockSize, elements.size() - first);
+            for (std::size_t i = 0; i < count; ++i) {
+                Scalar* v = block.data() + i * dimensions;
+                v[0] = elements[first + i].X();
+                v[1] = elements[first + i].Y();
+                if constexpr (dimensions == 3) {
+                    v[2] = elements[first + i].Z();
+                }
+            }
+            const auto bytes = static_cast<std::streamsize>(count * dimensions * sizeof(Scalar));
+            os.write(reinterpret_cast<const char*>(block.data()), bytes);
+        }
+    }
+}
+
+/// Normalized vectors are always read a block at a time, so that each one is
+/// constructed from its coordinates and renormalized, rather than trusting the
+/// data to hold unit vectors.
+template <typename T> [[nodiscard]] bool ReadCoordinates(std::istream& is, const std::span<T> elements) {
+    using Scalar = typename T::Scalar;
+    if constexpr (PackedElement<T> && IsNotNormalized(BaseTypeOfElement<T>)) {
+        const auto scalars = Span<T>(elements).Scalars();
+        const auto bytes = static_cast<std::streamsize>(scalars.size_bytes());
+        return static_cast<bool>(is.read(reinterpret_cast<char*>(scalars.data()), bytes));
+    } else {
+        constexpr std::size_t dimensions = Dimensions(BaseTypeOfElement<T>);
+        constexpr std::size_t blockSize = 256;
+        std::array<Scalar, blockSize * dimensions> block;
+        for (std::size_t first = 0; first < elements.size(); first += blockSize) {
+            const auto count = std::min(blockSize, elements.size() - first);
+            const auto bytes = static_cast<std::streamsize>(count * dimensions * sizeof(Scalar));
+            if (!is.read(reinterpret_cast<char*>(block.data()), bytes)) {
+                return false;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                const Scalar* v = block.data() + i * dimensions;
+                if constexpr (dimensions == 3) {
+                    elements[first + i] = T(v[0], v[1], v[2]);
+                } else {
+                    elements[first + i] = T(v[0], v[1]);
+                }
+            }
+        }
+        return true;
+    }
+}
+} // namespace implementation
+
+/// Writes a header and then the coordinates of every element of a contiguous
+/// range of points or vectors.
+template <typename Range> void WriteBinary(std::ostream& os, const Range& elements) {
+    using T = std::ranges::range_value_t<Range>;
+    const std::span<const T> typed(elements);
+    const BinaryHeader header = implementation::MakeHeader<T>(typed.size());
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    implementation::WriteCoordinates(os, typed);
+}
+
+/// Reads data written by WriteBinary and appends it to a contiguous
+/// container, such as a std::vector, of the same type in the same space.
+/// Throws if the header describes anything else, or if the data ends early, in
+/// which case the container is left as it was. Returns the number of elements
+/// appended.
+template <typename Container> std::size_t ReadBinary(std::istream& is, Container& out) {
+    using T = typename Container::value_type;
+    BinaryHeader header;
+    if (!is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::invalid_argument("The data ends before the binary header");
+    }
+    implementation::CheckHeader<T>(header);
+
+    const std::size_t first = out.size();
+    if (header.count > out.max_size() - first) {
+        throw std::invalid_argument("The data holds more elements than the container can");
+    }
+    const auto count = static_cast<std::size_t>(header.count);
+
+    // The count comes from the data, so the container only grows a block at a
+    // time as the coordinates arrive, and a corrupt count runs out of data
+    // long before it runs out of memory.
+    constexpr std::size_t blockSize = std::size_t{1} << 16;
+    try {
+        for (std::size_t read = 0; read < count;) {
+            const std::size_t n = std::min(blockSize, count - read);
+            out.resize(first + read + n);
+            if (!implementation::ReadCoordinates(is, std::span<T>(out).subspan(first + read, n))) {
+                throw std::invalid_argument("The data ends before all of its elements");
+            }
+            read += n;
+        }
+    } catch (...) {
+        out.resize(first);
+        throw;
+    }
+    return count;
+}
+} // namespace Space
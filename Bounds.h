@@ -0,0 +1,263 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// An axis-aligned box around points of one space. BT is the type of its
+/// corners, Point or XYPoint, and only points of that type can be put in it.
+/// A default-constructed box is empty, and contains nothing.
+template <typename ThisSpace, typename UnderlyingData, BaseType BT> class BoundingBox final {
+    static_assert(IsPoint(BT), "The corners of a bounding box must be points.");
+    using _point = typename CloudValue<ThisSpace, UnderlyingData, BT>::type;
+    using _extent = decltype(std::declval<const _point&>() - std::declval<const _point&>());
+    static constexpr std::size_t dimensions = Dimensions(BT);
+
+  public:
+    using Scalar = ScalarOf<ThisSpace>;
+
+    constexpr BoundingBox() noexcept {
+        lo.fill(std::numeric_limits<Scalar>::infinity());
+        hi.fill(-std::numeric_limits<Scalar>::infinity());
+    }
+
+    /// The corners can be given in any order.
+    constexpr BoundingBox(const _point& a, const _point& b) noexcept {
+        const auto ca = CoordinatesOf(a);
+        const auto cb = CoordinatesOf(b);
+        for (std::size_t d = 0; d < dimensions; ++d) {
+            lo[d] = std::min(ca[d], cb[d]);
+            hi[d] = std::max(ca[d], cb[d]);
+        }
+    }
+
+    [[nodiscard]] constexpr _point Min() const noexcept { return PointAt(lo); }
+    [[nodiscard]] constexpr _point Max() const noexcept { return PointAt(hi); }
+    [[nodiscard]] constexpr _extent Size() const noexcept { return Max() - Min(); }
+    [[nodiscard]] constexpr _point Center() const noexcept { return Min() + Size() * 0.5; }
+
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept {
+        for (std::size_t d = 0; d < dimensions; ++d) {
+            if (lo[d] > hi[d]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Points on the surface of the box are inside it.
+    [[nodiscard]] constexpr bool Contains(const Base<ThisSpace, UnderlyingData, BT>& p) const noexcept {
+        const auto c = CoordinatesOf(p);
+        for (std::size_t d = 0; d < dimensions; ++d) {
+            if (c[d] < lo[d] || c[d] > hi[d]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] constexpr bool Contains(const BoundingBox& other) const noexcept {
+        if (other.IsEmpty()) {
+            return true;
+        }
+        for (std::size_t d = 0; d < dimensions; ++d) {
+            if (other.lo[d] < lo[d] || other.hi[d] > hi[d]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Boxes which only touch overlap.
+    [[nodiscard]] constexpr bool Overlaps(const BoundingBox& other) const noexcept {
+        for (std::size_t d = 0; d < dimensions; ++d) {
+            if (other.hi[d] < lo[d] || other.lo[d] > hi[d]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr BoundingBox& Expand(const Base<ThisSpace, UnderlyingData, BT>& p) noexcept {
+        const auto c = CoordinatesOf(p);
+        for (std::size_t d = 0; d < dimensions; ++d) {
+            lo[d] = std::min(lo[d], c[d]);
+            hi[d] = std::max(hi[d], c[d]);
+        }
+        return *this;
+    }
+
+    constexpr BoundingBox& Expand(const BoundingBox& other) noexcept {
+        for (std::size_t d = 0; d < dimensions; ++d) {
+            lo[d] = std::min(lo[d], other.lo[d]);
+            hi[d] = std::max(hi[d], other.hi[d]);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const BoundingBox& other) const noexcept {
+        if (IsEmpty() || other.IsEmpty()) {
+            return IsEmpty() && other.IsEmpty();
+        }
+        return Min() == other.Min() && Max() == other.Max();
+    }
+    [[nodiscard]] constexpr bool operator!=(const BoundingBox& other) const noexcept { return !operator==(other); }
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space Contains(const Base<OtherSpace, UnderlyingData, OtherBaseType>&) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space Contains(const BoundingBox<OtherSpace, UnderlyingData, OtherBaseType>&) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space Overlaps(const BoundingBox<OtherSpace, UnderlyingData, OtherBaseType>&) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space Expand(const Base<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space Expand(const BoundingBox<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+
+    template <BaseType OtherBaseType> requires(OtherBaseType != BT)
+    StaticAssert::invalid_bounds_dimensions Contains(const Base<ThisSpace, UnderlyingData, OtherBaseType>&) const noexcept {
+        return StaticAssert::invalid_bounds_dimensions{};
+    }
+    template <BaseType OtherBaseType> requires(OtherBaseType != BT)
+    StaticAssert::invalid_bounds_dimensions
+    Contains(const BoundingBox<ThisSpace, UnderlyingData, OtherBaseType>&) const noexcept {
+        return StaticAssert::invalid_bounds_dimensions{};
+    }
+    template <BaseType OtherBaseType> requires(OtherBaseType != BT)
+    StaticAssert::invalid_bounds_dimensions
+    Overlaps(const BoundingBox<ThisSpace, UnderlyingData, OtherBaseType>&) const noexcept {
+        return StaticAssert::invalid_bounds_dimensions{};
+    }
+    template <BaseType OtherBaseType> requires(OtherBaseType != BT)
+    StaticAssert::invalid_bounds_dimensions Expand(const Base<ThisSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_bounds_dimensions{};
+    }
+#endif
+
+  private:
+    template <BaseType PBT>
+    [[nodiscard]] static constexpr std::array<Scalar, dimensions> CoordinatesOf(const Base<ThisSpace, UnderlyingData, PBT>& p) {
+        if constexpr (dimensions == 3) {
+            return {p.X(), p.Y(), p.Z()};
+        } else {
+            return {p.X(), p.Y()};
+        }
+    }
+
+    [[nodiscard]] static constexpr _point PointAt(const std::array<Scalar, dimensions>& c) noexcept {
+        if constexpr (dimensions == 3) {
+            return _point(c[0], c[1], c[2]);
+        } else {
+            return _point(c[0], c[1]);
+        }
+    }
+
+    std::array<Scalar, dimensions> lo;
+    std::array<Scalar, dimensions> hi;
+};
+
+template <typename ThisSpace, typename UnderlyingData> using AABB = BoundingBox<ThisSpace, UnderlyingData, BaseType::Point>;
+template <typename ThisSpace, typename UnderlyingData> using XYAABB = BoundingBox<ThisSpace, UnderlyingData, BaseType::XYPoint>;
+
+/// Runs MinMaxKernel on one thread per block of elements, once there are
+/// enough elements for the threads to be worth starting.
+template <typename Scalar>
+static void ParallelMinMax(
+    const Scalar* p,
+    const std::size_t count,
+    const std::size_t stride,
+    const std::size_t dimensions,
+    Scalar* lo,
+    Scalar* hi
+) {
+    const std::size_t threads = ThreadsFor(count);
+    if (threads == 1) {
+        MinMaxKernel(p, count, stride, dimensions, lo, hi);
+        return;
+    }
+
+    std::vector<std::array<Scalar, 6>> partial(threads);
+    OnThreads(threads, count, [&](const std::size_t t, const std::size_t first, const std::size_t last) {
+        auto& bounds = partial[t];
+        std::copy_n(lo, dimensions, bounds.begin());
+        std::copy_n(hi, dimensions, bounds.begin() + 3);
+        MinMaxKernel(p + first * stride, last - first, stride, dimensions, bounds.data(), bounds.data() + 3);
+    });
+    for (const auto& bounds : partial) {
+        for (std::size_t d = 0; d < dimensions; ++d) {
+            lo[d] = std::min(lo[d], bounds[d]);
+            hi[d] = std::max(hi[d], bounds[d + 3]);
+        }
+    }
+}
+
+/// The smallest box around all of the points in a span or cloud. Large inputs
+/// are split between threads, and each thread works through its part a SIMD
+/// pack at a time.
+template <typename Element> requires(IsPoint(BaseTypeOfSpan<Element>))
+[[nodiscard]] auto Bounds(const Span<Element>& points) {
+    using _value = ValueOfSpan<Element>;
+    constexpr BaseType BT = BaseTypeOfSpan<Element>;
+    using _space = decltype(SpaceTypeOf(std::declval<const _value&>()));
+    using _box = BoundingBox<_space, decltype(UnderlyingTypeOf(std::declval<const _value&>())), BT>;
+    using Scalar = ScalarOfSpan<Element>;
+    if (points.empty()) {
+        return _box();
+    }
+    std::array<Scalar, 3> lo;
+    std::array<Scalar, 3> hi;
+    lo.fill(std::numeric_limits<Scalar>::infinity());
+    hi.fill(-std::numeric_limits<Scalar>::infinity());
+    ParallelMinMax(SpanScalars(points), points.size(), strideOf<Element>, Dimensions(BT), lo.data(), hi.data());
+    if constexpr (Is3D(BT)) {
+        return _box(_value(lo[0], lo[1], lo[2]), _value(hi[0], hi[1], hi[2]));
+    } else {
+        return _box(_value(lo[0], lo[1]), _value(hi[0], hi[1]));
+    }
+}
+
+template <typename ThisSpace, typename UnderlyingData, BaseType BT> requires(IsPoint(BT))
+[[nodiscard]] auto Bounds(const Cloud<ThisSpace, UnderlyingData, BT>& cloud) {
+    using _value = typename CloudValue<ThisSpace, UnderlyingData, BT>::type;
+    using _box = BoundingBox<ThisSpace, UnderlyingData, BT>;
+    using Scalar = ScalarOf<ThisSpace>;
+    if (cloud.empty()) {
+        return _box();
+    }
+    // Each column is contiguous, so it is reduced as a run of single values.
+    std::array<Scalar, 3> lo;
+    std::array<Scalar, 3> hi;
+    lo.fill(std::numeric_limits<Scalar>::infinity());
+    hi.fill(-std::numeric_limits<Scalar>::infinity());
+    ParallelMinMax(cloud.Xs().data(), cloud.size(), 1, 1, &lo[0], &hi[0]);
+    ParallelMinMax(cloud.Ys().data(), cloud.size(), 1, 1, &lo[1], &hi[1]);
+    if constexpr (Is3D(BT)) {
+        ParallelMinMax(cloud.Zs().data(), cloud.size(), 1, 1, &lo[2], &hi[2]);
+        return _box(_value(lo[0], lo[1], lo[2]), _value(hi[0], hi[1], hi[2]));
+    } else {
+        return _box(_value(lo[0], lo[1]), _value(hi[0], hi[1]));
+    }
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+template <typename Element> requires(IsVector(BaseTypeOfSpan<Element>))
+StaticAssert::invalid_vector_bounds Bounds(const Span<Element>&) noexcept {
+    return StaticAssert::invalid_vector_bounds{};
+}
+
+template <typename ThisSpace, typename UnderlyingData, BaseType BT> requires(IsVector(BT))
+StaticAssert::invalid_vector_bounds Bounds(const Cloud<ThisSpace, UnderlyingData, BT>&) noexcept {
+    return StaticAssert::invalid_vector_bounds{};
+}
+#endif
+
+} // namespace Space::implementation
@@ -0,0 +1,418 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// A half-line in one space, starting at Origin and going along Direction.
+template <typename ThisSpace, typename UnderlyingData> class Ray final {
+    using _point = Point<ThisSpace, UnderlyingData>;
+    using _direction = NormalizedVector<ThisSpace, UnderlyingData>;
+
+  public:
+    using Scalar = ScalarOf<ThisSpace>;
+
+    constexpr Ray(const _point& origin, const _direction& direction) noexcept : origin(origin), direction(direction) {}
+
+    [[nodiscard]] constexpr const _point& Origin() const noexcept { return origin; }
+    [[nodiscard]] constexpr const _direction& Direction() const noexcept { return direction; }
+
+    /// The point at distance t along the ray.
+    [[nodiscard]] constexpr _point At(const Scalar t) const noexcept { return origin + direction * t; }
+
+  private:
+    _point origin;
+    _direction direction;
+};
+
+/// A bounding volume hierarchy over the boxes of objects in one space, for
+/// finding the objects that a ray hits or that a box overlaps. Objects are
+/// referred to by the index of their box in the boxes that the hierarchy was
+/// built from.
+///
+/// The hierarchy is built top-down, splitting each node where the surface area
+/// heuristic, estimated over a fixed number of bins, predicts the cheapest
+/// searches. The nodes are stored depth-first in one array, with the left
+/// child of each node straight after it. When objects move, Refit updates the
+/// boxes without changing the tree, which is much faster than a rebuild but
+/// gives slower searches as the objects move further from where they started.
+template <typename ThisSpace, typename UnderlyingData> class Bvh final {
+    using _box = AABB<ThisSpace, UnderlyingData>;
+    using _ray = Ray<ThisSpace, UnderlyingData>;
+
+  public:
+    using Scalar = ScalarOf<ThisSpace>;
+    /// An object whose box was hit, with the distance along the ray to the hit.
+    using Hit = Neighbour<Scalar>;
+
+    Bvh() noexcept = default;
+
+    /// Throws if any of the boxes are empty.
+    explicit Bvh(const std::span<const _box> boxes) {
+        if (boxes.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::invalid_argument("A Bvh can hold at most 4294967295 boxes");
+        }
+        CheckBoxes(boxes);
+        order.resize(boxes.size());
+        std::iota(order.begin(), order.end(), std::uint32_t{0});
+        if (boxes.empty()) {
+            return;
+        }
+        std::vector<std::array<Scalar, 3>> centres(boxes.size());
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            const auto c = boxes[i].Center();
+            centres[i] = {c.X(), c.Y(), c.Z()};
+        }
+        nodes.reserve(2 * boxes.size() / leafSize + 1);
+        Build(boxes, centres, 0, boxes.size(), 0);
+        Gather(boxes);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return order.size(); }
+    [[nodiscard]] bool empty() const noexcept { return order.empty(); }
+
+    /// The box around every object, which is empty if there are none.
+    [[nodiscard]] _box Bounds() const noexcept { return nodes.empty() ? _box() : nodes.front().box; }
+
+    /// Moves the objects to new boxes, given in the same order as the boxes the
+    /// hierarchy was built from, and updates the boxes of the nodes to match.
+    void Refit(const std::span<const _box> boxes) {
+        if (boxes.size() != size()) {
+            throw std::invalid_argument("Refit needs one box for each object in the Bvh");
+        }
+        CheckBoxes(boxes);
+        Gather(boxes);
+        // Children are always after their parents, so each node is refitted after its children.
+        for (std::size_t n = nodes.size(); n-- > 0;) {
+            Node& node = nodes[n];
+            if (node.count > 0) {
+                node.box = _box();
+                for (std::size_t i = node.first; i < node.first + node.count; ++i) {
+                    node.box.Expand(objectBoxes[i]);
+                }
+            } else {
+                node.box = nodes[n + 1].box;
+                node.box.Expand(nodes[node.first].box);
+            }
+        }
+    }
+
+    /// The closest object that the ray hits, no further than maxDistance along
+    /// it. intersect is called with the index of each object whose box the ray
+    /// hits, nearest boxes first, and returns the distance along the ray to the
+    /// object, or nothing if the ray misses it.
+    template <typename Intersect> requires(std::is_invocable_r_v<std::optional<Scalar>, Intersect&, std::size_t>)
+    [[nodiscard]] std::optional<Hit> Closest(
+        const _ray& ray,
+        Intersect&& intersect,
+        const Scalar maxDistance = std::numeric_limits<Scalar>::infinity()
+    ) const {
+        std::optional<Hit> closest;
+        Scalar limit = maxDistance;
+        Traverse(ray, limit, [&](const std::size_t i, Scalar) {
+            const std::optional<Scalar> distance = intersect(static_cast<std::size_t>(order[i]));
+            if (distance && *distance >= 0 && *distance <= limit) {
+                const Hit hit{order[i], *distance};
+                if (!closest || Closer(hit, *closest)) {
+                    closest = hit;
+                    limit = hit.distance;
+                }
+            }
+        });
+        return closest;
+    }
+
+    /// Every object whose box the ray enters no further than maxDistance along
+    /// it, with the distance to where it enters the box, closest first. The
+    /// results replace the contents of out.
+    void Intersecting(
+        const _ray& ray,
+        std::vector<Hit>& out,
+        const Scalar maxDistance = std::numeric_limits<Scalar>::infinity()
+    ) const {
+        out.clear();
+        Scalar limit = maxDistance;
+        Traverse(ray, limit, [&](const std::size_t i, const Scalar entry) { out.push_back({order[i], entry}); });
+        std::sort(out.begin(), out.end(), Closer<Scalar>);
+    }
+
+    [[nodiscard]] std::vector<Hit>
+    Intersecting(const _ray& ray, const Scalar maxDistance = std::numeric_limits<Scalar>::infinity()) const {
+        std::vector<Hit> out;
+        Intersecting(ray, out, maxDistance);
+        return out;
+    }
+
+    /// The indices of every object whose box overlaps the given box, in
+    /// ascending order. The results replace the contents of out.
+    void Overlapping(const _box& box, std::vector<std::size_t>& out) const {
+        out.clear();
+        if (nodes.empty() || box.IsEmpty()) {
+            return;
+        }
+        std::array<std::uint32_t, maxDepth + 1> pending;
+        std::size_t top = 0;
+        pending[top++] = 0;
+        while (top > 0) {
+            const std::uint32_t index = pending[--top];
+            const Node& node = nodes[index];
+            if (!node.box.Overlaps(box)) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (std::size_t i = node.first; i < node.first + node.count; ++i) {
+                    if (objectBoxes[i].Overlaps(box)) {
+                        out.push_back(order[i]);
+                    }
+                }
+            } else {
+                pending[top++] = node.first;
+                pending[top++] = index + 1;
+            }
+        }
+        std::sort(out.begin(), out.end());
+    }
+
+    [[nodiscard]] std::vector<std::size_t> Overlapping(const _box& box) const {
+        std::vector<std::size_t> out;
+        Overlapping(box, out);
+        return out;
+    }
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, typename... Args>
+    StaticAssert::invalid_space Closest(const Ray<OtherSpace, UnderlyingData>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, typename... Args>
+    StaticAssert::invalid_space Intersecting(const Ray<OtherSpace, UnderlyingData>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType, typename... Args>
+    StaticAssert::invalid_space
+    Overlapping(const BoundingBox<OtherSpace, UnderlyingData, OtherBaseType>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+#endif
+
+  private:
+    static constexpr std::size_t leafSize = 4;
+    static constexpr std::size_t binCount = 16;
+    static constexpr std::size_t maxDepth = 62;
+
+    /// A leaf holds count objects from first. Other nodes have a count of zero,
+    /// their left child is the next node, and first is their right child.
+    struct Node final {
+        _box box;
+        std::uint32_t first = 0;
+        std::uint32_t count = 0;
+    };
+
+    struct Bin final {
+        _box box;
+        std::size_t count = 0;
+    };
+
+    static void CheckBoxes(const std::span<const _box> boxes) {
+        if (std::any_of(boxes.begin(), boxes.end(), [](const _box& box) { return box.IsEmpty(); })) {
+            throw std::invalid_argument("Every box in a Bvh must hold at least one point");
+        }
+    }
+
+    [[nodiscard]] static Scalar SurfaceArea(const _box& box) noexcept {
+        if (box.IsEmpty()) {
+            return 0;
+        }
+        const auto size = box.Size();
+        return 2 * (size.X() * size.Y() + size.Y() * size.Z() + size.Z() * size.X());
+    }
+
+    /// Copies the boxes into the order of the leaves, so that each leaf reads its boxes from one place.
+    void Gather(const std::span<const _box> boxes) {
+        objectBoxes.resize(order.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            objectBoxes[i] = boxes[order[i]];
+        }
+    }
+
+    /// Builds the subtree of the objects from first to last, and returns the index of its root.
+    std::uint32_t Build(
+        const std::span<const _box> boxes,
+        const std::vector<std::array<Scalar, 3>>& centres,
+        const std::size_t first,
+        const std::size_t last,
+        const std::size_t depth
+    ) {
+        const auto index = static_cast<std::uint32_t>(nodes.size());
+        nodes.emplace_back();
+        _box box;
+        _box centreBounds;
+        for (std::size_t i = first; i < last; ++i) {
+            box.Expand(boxes[order[i]]);
+            const auto& c = centres[order[i]];
+            centreBounds.Expand(Point<ThisSpace, UnderlyingData>(c[0], c[1], c[2]));
+        }
+        nodes[index].box = box;
+
+        const std::size_t count = last - first;
+        const auto makeLeaf = [&] {
+            nodes[index].first = static_cast<std::uint32_t>(first);
+            nodes[index].count = static_cast<std::uint32_t>(count);
+            return index;
+        };
+        if (count <= 1 || depth == maxDepth) {
+            return makeLeaf();
+        }
+
+        const auto lo = centreBounds.Min();
+        const auto extent = centreBounds.Size();
+        const std::array<Scalar, 3> low{lo.X(), lo.Y(), lo.Z()};
+        const std::array<Scalar, 3> width{extent.X(), extent.Y(), extent.Z()};
+        const auto binOf = [&](const std::size_t object, const std::size_t axis) {
+            const Scalar position = (centres[object][axis] - low[axis]) / width[axis] * binCount;
+            return std::min(static_cast<std::size_t>(position), binCount - 1);
+        };
+
+        // Find the cheapest split between bins along any axis. Each split costs
+        // one step down the tree plus a test of each object, weighted by the
+        // chance that a ray through this node also goes through each side.
+        Scalar bestCost = std::numeric_limits<Scalar>::infinity();
+        std::size_t bestAxis = 0;
+        std::size_t bestSplit = 0;
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            if (!(width[axis] > 0)) {
+                continue;
+            }
+            std::array<Bin, binCount> bins{};
+            for (std::size_t i = first; i < last; ++i) {
+                Bin& bin = bins[binOf(order[i], axis)];
+                bin.box.Expand(boxes[order[i]]);
+                ++bin.count;
+            }
+            // The area and count of everything to the right of each split, swept from the right.
+            std::array<Scalar, binCount> rightArea{};
+            std::array<std::size_t, binCount> rightCount{};
+            _box right;
+            std::size_t inRight = 0;
+            for (std::size_t b = binCount - 1; b > 0; --b) {
+                right.Expand(bins[b].box);
+                inRight += bins[b].count;
+                rightArea[b] = SurfaceArea(right);
+                rightCount[b] = inRight;
+            }
+            _box left;
+            std::size_t inLeft = 0;
+            for (std::size_t split = 1; split < binCount; ++split) {
+                left.Expand(bins[split - 1].box);
+                inLeft += bins[split - 1].count;
+                if (inLeft == 0 || rightCount[split] == 0) {
+                    continue;
+                }
+                const Scalar cost = SurfaceArea(left) * static_cast<Scalar>(inLeft) +
+                                    rightArea[split] * static_cast<Scalar>(rightCount[split]);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = split;
+                }
+            }
+        }
+
+        const Scalar area = SurfaceArea(box);
+        const Scalar splitCost = 1 + (area > 0 ? bestCost / area : 0);
+        std::size_t middle;
+        if (bestSplit > 0 && (splitCost < static_cast<Scalar>(count) || count > leafSize)) {
+            const auto split = std::partition(order.begin() + first, order.begin() + last, [&](const std::uint32_t object) {
+                return binOf(object, bestAxis) < bestSplit;
+            });
+            middle = static_cast<std::size_t>(split - order.begin());
+        } else if (count > leafSize) {
+            // The centres are all in one place, so no split separates them; halve the objects instead.
+            middle = first + count / 2;
+        } else {
+            return makeLeaf();
+        }
+
+        Build(boxes, centres, first, middle, depth + 1);
+        nodes[index].first = Build(boxes, centres, middle, last, depth + 1);
+        return index;
+    }
+
+    /// The distance along the ray at which it enters the box, if it does so
+    /// before limit.
+    [[nodiscard]] static std::optional<Scalar> Entry(
+        const _box& box,
+        const std::array<Scalar, 3>& origin,
+        const std::array<Scalar, 3>& inverse,
+        const Scalar limit
+    ) noexcept {
+        const auto lo = box.Min();
+        const auto hi = box.Max();
+        const std::array<Scalar, 3> low{lo.X(), lo.Y(), lo.Z()};
+        const std::array<Scalar, 3> high{hi.X(), hi.Y(), hi.Z()};
+        Scalar near = 0;
+        Scalar far = limit;
+        for (std::size_t d = 0; d < 3; ++d) {
+            const Scalar t0 = (low[d] - origin[d]) * inverse[d];
+            const Scalar t1 = (high[d] - origin[d]) * inverse[d];
+            near = std::max(near, std::min(t0, t1));
+            far = std::min(far, std::max(t0, t1));
+        }
+        if (near > far) {
+            return std::nullopt;
+        }
+        return near;
+    }
+
+    /// Calls visit with the position in the leaves of each object whose box the
+    /// ray enters before limit, and the distance to where it enters. Nearer
+    /// children are visited first, and visit may reduce limit to skip the
+    /// boxes that are further away.
+    template <typename Visitor> void Traverse(const _ray& ray, Scalar& limit, Visitor&& visit) const {
+        if (nodes.empty()) {
+            return;
+        }
+        const auto& o = ray.Origin();
+        const auto& d = ray.Direction();
+        const std::array<Scalar, 3> origin{o.X(), o.Y(), o.Z()};
+        const std::array<Scalar, 3> inverse{Scalar{1} / d.X(), Scalar{1} / d.Y(), Scalar{1} / d.Z()};
+
+        std::array<std::pair<std::uint32_t, Scalar>, maxDepth + 1> pending;
+        std::size_t top = 0;
+        if (const auto entry = Entry(nodes[0].box, origin, inverse, limit)) {
+            pending[top++] = {0, *entry};
+        }
+        while (top > 0) {
+            const auto [index, entry] = pending[--top];
+            if (entry > limit) {
+                continue;
+            }
+            const Node& node = nodes[index];
+            if (node.count > 0) {
+                for (std::size_t i = node.first; i < node.first + node.count; ++i) {
+                    if (const auto hit = Entry(objectBoxes[i], origin, inverse, limit)) {
+                        visit(i, *hit);
+                    }
+                }
+                continue;
+            }
+            const std::uint32_t leftIndex = index + 1;
+            const std::uint32_t rightIndex = node.first;
+            const auto left = Entry(nodes[leftIndex].box, origin, inverse, limit);
+            const auto right = Entry(nodes[rightIndex].box, origin, inverse, limit);
+            // Push the further child first so that the nearer one is searched first.
+            if (left && right) {
+                const bool leftFirst = *left <= *right;
+                pending[top++] = leftFirst ? std::pair{rightIndex, *right} : std::pair{leftIndex, *left};
+                pending[top++] = leftFirst ? std::pair{leftIndex, *left} : std::pair{rightIndex, *right};
+            } else if (left) {
+                pending[top++] = {leftIndex, *left};
+            } else if (right) {
+                pending[top++] = {rightIndex, *right};
+            }
+        }
+    }
+
+    std::vector<Node> nodes;
+    std::vector<std::uint32_t> order;
+    std::vector<_box> objectBoxes;
+};
+} // namespace Space::implementation
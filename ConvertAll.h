@@ -0,0 +1,207 @@
+#pragma once
+
+namespace Space {
+
+/// Anything which can run task(i) for every i below count, possibly on several
+/// threads at once, and returns once all of them have finished. Any exception
+/// thrown by a task is rethrown to the caller.
+template <typename E>
+concept Executor = requires(E& executor, void (*task)(std::size_t)) { executor.ForEach(std::size_t{1}, task); };
+
+/// A fixed set of threads which share the tasks of each ForEach. The tasks are
+/// first split evenly between the threads, and a thread which runs out of its
+/// own takes from the end of another's, so a slow part of the range doesn't
+/// hold up the rest. The thread which calls ForEach works on the tasks too.
+///
+/// Calls to ForEach from different threads take turns. A task must not call
+/// ForEach on the pool which is running it.
+class WorkStealingPool final {
+  public:
+    WorkStealingPool() : WorkStealingPool(std::max<std::size_t>(1, std::thread::hardware_concurrency())) {}
+
+    /// A pool of the given number of threads, including the one which calls ForEach.
+    explicit WorkStealingPool(const std::size_t threads) : queues(threads) {
+        if (threads == 0) {
+            throw std::invalid_argument("A pool needs at least one thread");
+        }
+        workers.reserve(threads - 1);
+        for (std::size_t t = 1; t < threads; ++t) {
+            workers.emplace_back([this, t](const std::stop_token stop) { Loop(stop, t); });
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    [[nodiscard]] std::size_t size() const noexcept { return queues.size(); }
+
+    /// Runs task(i) for every i below count. If a task throws, the tasks which
+    /// have not started yet are skipped and the first exception is rethrown.
+    template <typename Task> void ForEach(const std::size_t count, Task task) {
+        if (count == 0) {
+            return;
+        }
+        const std::lock_guard turn(running);
+        if (workers.empty() || count == 1) {
+            for (std::size_t i = 0; i < count; ++i) {
+                task(i);
+            }
+            return;
+        }
+
+        // The workers are all waiting, so the queues can be filled without locking them.
+        const std::size_t threads = queues.size();
+        for (std::size_t t = 0; t < threads; ++t) {
+            queues[t].first = count * t / threads;
+            queues[t].last = count * (t + 1) / threads;
+        }
+        {
+            const std::lock_guard lock(mutex);
+            run = [](void* context, const std::size_t i) { (*static_cast<Task*>(context))(i); };
+            context = &task;
+            failure = nullptr;
+            failed.store(false, std::memory_order_relaxed);
+            busy = workers.size();
+            ++generation;
+        }
+        wake.notify_all();
+        Work(0);
+
+        std::unique_lock lock(mutex);
+        finished.wait(lock, [this] { return busy == 0; });
+        if (failure) {
+            std::rethrow_exception(std::exchange(failure, nullptr));
+        }
+    }
+
+  private:
+    /// The tasks from first up to last which are still waiting to run. Each
+    /// queue has a cache line to itself so that threads taking from their own
+    /// queues don't slow each other down.
+    struct alignas(64) Queue final {
+        std::mutex mutex;
+        std::size_t first = 0;
+        std::size_t last = 0;
+    };
+
+    void Loop(const std::stop_token stop, const std::size_t worker) {
+        std::size_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock lock(mutex);
+                if (!wake.wait(lock, stop, [&] { return generation != seen; })) {
+                    return;
+                }
+                seen = generation;
+            }
+            Work(worker);
+            const std::lock_guard lock(mutex);
+            if (--busy == 0) {
+                finished.notify_one();
+            }
+        }
+    }
+
+    void Work(const std::size_t worker) {
+        std::size_t task;
+        while (Take(worker, task)) {
+            if (failed.load(std::memory_order_relaxed)) {
+                continue;
+            }
+            try {
+                run(context, task);
+            } catch (...) {
+                const std::lock_guard lock(mutex);
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+                failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Takes the next task from the front of the worker's own queue, or else
+    /// from the back of another queue. Queues only shrink while the tasks run,
+    /// so once every queue has been seen empty there is nothing left to do.
+    bool Take(const std::size_t worker, std::size_t& task) {
+        const std::size_t threads = queues.size();
+        {
+            Queue& own = queues[worker];
+            const std::lock_guard lock(own.mutex);
+            if (own.first < own.last) {
+                task = own.first++;
+                return true;
+            }
+        }
+        for (std::size_t k = 1; k < threads; ++k) {
+            Queue& victim = queues[(worker + k) % threads];
+            const std::lock_guard lock(victim.mutex);
+            if (victim.first < victim.last) {
+                task = --victim.last;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<Queue> queues;
+    std::mutex running;
+
+    std::mutex mutex;
+    std::condition_variable_any wake;
+    std::condition_variable finished;
+    std::size_t generation = 0;
+    std::size_t busy = 0;
+    void (*run)(void*, std::size_t) = nullptr;
+    void* context = nullptr;
+    std::exception_ptr failure;
+    std::atomic<bool> failed = false;
+
+    // Last, so that the threads are stopped and joined before anything they use is destroyed.
+    std::vector<std::jthread> workers;
+};
+
+namespace implementation {
+
+/// Converts every element of a span to another space on an executor, writing
+/// the results to the matching positions of out. The span is cut into blocks
+/// of a fixed size, which are passed to the Transform Manager's batch call if
+/// it has one, so the blocks and the results don't depend on how many threads
+/// the executor has or which thread converts which block. The Transform Manager
+/// is only used through const references, from several threads at once.
+template <typename OtherSpace, typename Element, typename TransformManager, typename OtherElement, Executor E>
+requires(!std::is_same_v<OtherSpace, SpaceOfSpan<Element>>)
+void ConvertAll(
+    const Span<Element>& in,
+    const TransformManager& transform_manager,
+    const Span<OtherElement>& out,
+    E& executor
+) {
+    constexpr std::size_t blockSize = std::size_t{1} << 14;
+    CheckSizes(in.size(), out.size());
+    executor.ForEach((in.size() + blockSize - 1) / blockSize, [&](const std::size_t block) {
+        const std::size_t first = block * blockSize;
+        const std::size_t count = std::min(blockSize, in.size() - first);
+        in.subspan(first, count).template ConvertTo<OtherSpace>(transform_manager, out.subspan(first, count));
+    });
+}
+
+template <typename OtherSpace, typename Element, typename TransformManager, Executor E>
+requires(!std::is_same_v<OtherSpace, SpaceOfSpan<Element>>)
+[[nodiscard]] auto ConvertAll(const Span<Element>& in, const TransformManager& transform_manager, E& executor) {
+    using _converted = typename decltype(in.template ConvertTo<OtherSpace>(transform_manager))::value_type;
+    std::vector<_converted> converted(in.size());
+    ConvertAll<OtherSpace>(in, transform_manager, Span<_converted>(converted), executor);
+    return converted;
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+template <typename OtherSpace, typename Element, typename TransformManager, typename... Args>
+requires(std::is_same_v<OtherSpace, SpaceOfSpan<Element>>)
+StaticAssert::invalid_same_space_conversion ConvertAll(const Span<Element>&, const TransformManager&, Args&&...) noexcept {
+    return StaticAssert::invalid_same_space_conversion{};
+}
+#endif
+
+} // namespace implementation
+} // namespace Space
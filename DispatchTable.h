@@ -0,0 +1,45 @@
+#pragma once
+
+namespace Space {
+
+/// A space whose id is a compile-time constant of the given enum.
+template <typename S, typename Id>
+concept HasConstantId = std::is_enum_v<Id> && requires { typename std::integral_constant<Id, S::id>; };
+
+/// Holds one Entry for each ordered pair of space ids, such as a matrix or a
+/// function pointer. The slot for a pair of spaces is found at compile time
+/// from their ids, so a Transform Manager can look up its conversion without
+/// branching on the spaces for every point.
+template <typename Id, std::size_t Count, typename Entry> class DispatchTable final {
+
+    template <typename S> static consteval std::size_t IdIndex() {
+        constexpr auto index = static_cast<std::size_t>(S::id);
+        static_assert(index < Count, "The space id is outside the dispatch table.");
+        return index;
+    }
+
+    template <typename From, typename To> static constexpr std::size_t slot = IdIndex<From>() * Count + IdIndex<To>();
+
+  public:
+    DispatchTable() = default;
+
+    /// Every slot starts as a copy of the given entry.
+    explicit DispatchTable(const Entry& entry) { entries.fill(entry); }
+
+    template <HasConstantId<Id> From, HasConstantId<Id> To> [[nodiscard]] Entry& At() noexcept {
+        return entries[slot<From, To>];
+    }
+
+    template <HasConstantId<Id> From, HasConstantId<Id> To> [[nodiscard]] const Entry& At() const noexcept {
+        return entries[slot<From, To>];
+    }
+
+    template <HasConstantId<Id> From, HasConstantId<Id> To> void Set(Entry entry) {
+        entries[slot<From, To>] = std::move(entry);
+    }
+
+  private:
+    std::array<Entry, Count * Count> entries{};
+};
+
+} // namespace Space
@@ -0,0 +1,292 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// A point found by a spatial query: its index in the points that the index
+/// was built from, and its distance from the query.
+template <typename Scalar> struct Neighbour final {
+    std::size_t index = 0;
+    Scalar distance = 0;
+
+    [[nodiscard]] constexpr bool operator==(const Neighbour&) const noexcept = default;
+};
+
+/// Neighbours are ordered by distance, and then by index so that points at the
+/// same distance are always reported in the same order.
+template <typename Scalar> [[nodiscard]] constexpr bool Closer(const Neighbour<Scalar>& a, const Neighbour<Scalar>& b) noexcept {
+    return a.distance < b.distance || (a.distance == b.distance && a.index < b.index);
+}
+
+/// A k-d tree over the points of one space, for nearest-neighbour and radius
+/// searches. The tree keeps its own copy of the coordinates, so the points it
+/// was built from can change or go away, and results refer to them by index.
+///
+/// The nodes are stored depth-first in one array, with the left child of each
+/// node straight after it, and the coordinates are stored in the order of the
+/// leaves, so a search walks forwards through memory. Large trees are built
+/// on several threads.
+template <typename ThisSpace, typename UnderlyingData> class KdTree final {
+    using _point = Point<ThisSpace, UnderlyingData>;
+
+  public:
+    using Scalar = ScalarOf<ThisSpace>;
+    using Neighbour = implementation::Neighbour<Scalar>;
+
+    KdTree() noexcept = default;
+
+    explicit KdTree(const ConstPointSpan<ThisSpace, UnderlyingData>& points) : coordinates(points.size()) {
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            coordinates[i] = {points[i].X(), points[i].Y(), points[i].Z()};
+        }
+        Build();
+    }
+
+    explicit KdTree(const PointCloud<ThisSpace, UnderlyingData>& points) : coordinates(points.size()) {
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            coordinates[i] = {points.Xs()[i], points.Ys()[i], points.Zs()[i]};
+        }
+        Build();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return coordinates.size(); }
+    [[nodiscard]] bool empty() const noexcept { return coordinates.empty(); }
+
+    /// The closest point to the query, or nothing if the tree is empty.
+    [[nodiscard]] std::optional<Neighbour> Nearest(const _point& query) const {
+        if (empty()) {
+            return std::nullopt;
+        }
+        Neighbour best{0, std::numeric_limits<Scalar>::infinity()};
+        Scalar radiusSquared = best.distance;
+        Search(query, radiusSquared, [&](const std::size_t index, const Scalar distanceSquared) {
+            if (Closer(Neighbour{index, distanceSquared}, best)) {
+                best = {index, distanceSquared};
+                radiusSquared = distanceSquared;
+            }
+        });
+        best.distance = std::sqrt(best.distance);
+        return best;
+    }
+
+    /// The k closest points to the query, closest first. The results replace
+    /// the contents of out, so that one vector can be reused between searches.
+    void Nearest(const _point& query, const std::size_t k, std::vector<Neighbour>& out) const {
+        out.clear();
+        if (k == 0 || empty()) {
+            return;
+        }
+        out.reserve(std::min(k, size()));
+        // out is a max-heap of the best points so far, with the furthest at the front.
+        const auto closer = Closer<Scalar>;
+        Scalar radiusSquared = std::numeric_limits<Scalar>::infinity();
+        Search(query, radiusSquared, [&](const std::size_t index, const Scalar distanceSquared) {
+            const Neighbour candidate{index, distanceSquared};
+            if (out.size() < k) {
+                out.push_back(candidate);
+                std::push_heap(out.begin(), out.end(), closer);
+            } else if (Closer(candidate, out.front())) {
+                std::pop_heap(out.begin(), out.end(), closer);
+                out.back() = candidate;
+                std::push_heap(out.begin(), out.end(), closer);
+            }
+            if (out.size() == k) {
+                radiusSquared = out.front().distance;
+            }
+        });
+        std::sort_heap(out.begin(), out.end(), closer);
+        for (auto& neighbour : out) {
+            neighbour.distance = std::sqrt(neighbour.distance);
+        }
+    }
+
+    [[nodiscard]] std::vector<Neighbour> Nearest(const _point& query, const std::size_t k) const {
+        std::vector<Neighbour> out;
+        Nearest(query, k, out);
+        return out;
+    }
+
+    /// Every point no further than radius from the query, closest first. The
+    /// results replace the contents of out.
+    void WithinRadius(const _point& query, const Scalar radius, std::vector<Neighbour>& out) const {
+        out.clear();
+        if (radius < 0 || empty()) {
+            return;
+        }
+        Scalar radiusSquared = radius * radius;
+        Search(query, radiusSquared, [&](const std::size_t index, const Scalar distanceSquared) {
+            out.push_back({index, distanceSquared});
+        });
+        std::sort(out.begin(), out.end(), Closer<Scalar>);
+        for (auto& neighbour : out) {
+            neighbour.distance = std::sqrt(neighbour.distance);
+        }
+    }
+
+    [[nodiscard]] std::vector<Neighbour> WithinRadius(const _point& query, const Scalar radius) const {
+        std::vector<Neighbour> out;
+        WithinRadius(query, radius, out);
+        return out;
+    }
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType, typename... Args>
+    StaticAssert::invalid_space Nearest(const Base<OtherSpace, UnderlyingData, OtherBaseType>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType, typename... Args>
+    StaticAssert::invalid_space WithinRadius(const Base<OtherSpace, UnderlyingData, OtherBaseType>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+
+    template <BaseType OtherBaseType, typename... Args> requires(OtherBaseType != BaseType::Point)
+    StaticAssert::invalid_spatial_query Nearest(const Base<ThisSpace, UnderlyingData, OtherBaseType>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_spatial_query{};
+    }
+    template <BaseType OtherBaseType, typename... Args> requires(OtherBaseType != BaseType::Point)
+    StaticAssert::invalid_spatial_query
+    WithinRadius(const Base<ThisSpace, UnderlyingData, OtherBaseType>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_spatial_query{};
+    }
+#endif
+
+  private:
+    static constexpr std::size_t leafSize = 8;
+    static constexpr std::uint32_t leaf = 3;
+
+    /// A leaf holds the points from first to first + count. Other nodes split
+    /// their points at split along axis, and their left child is the next node.
+    struct Node final {
+        Scalar split;
+        std::uint32_t axis;
+        std::uint32_t right;
+        std::uint32_t first;
+        std::uint32_t count;
+    };
+
+    /// The numbers of nodes in the trees of count and count + 1 points. Halving
+    /// either of those sizes only ever gives count / 2 or count / 2 + 1, so this
+    /// takes one step per level.
+    [[nodiscard]] static constexpr std::pair<std::size_t, std::size_t> NodeCounts(const std::size_t count) noexcept {
+        if (count + 1 <= leafSize) {
+            return {1, 1};
+        }
+        if (count <= leafSize) {
+            return {1, 3};
+        }
+        const auto [half, halfPlusOne] = NodeCounts(count / 2);
+        if (count % 2 == 0) {
+            return {1 + 2 * half, 1 + half + halfPlusOne};
+        }
+        return {1 + half + halfPlusOne, 1 + 2 * halfPlusOne};
+    }
+
+    void Build() {
+        const std::size_t count = coordinates.size();
+        if (count > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::invalid_argument("A KdTree can hold at most 4294967295 points");
+        }
+        indices.resize(count);
+        std::iota(indices.begin(), indices.end(), std::uint32_t{0});
+        if (count == 0) {
+            return;
+        }
+        nodes.resize(NodeCounts(count).first);
+        Build(0, 0, count, ThreadsFor(count));
+
+        // Put the coordinates in the order of the leaves.
+        std::vector<std::array<Scalar, 3>> ordered(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            ordered[i] = coordinates[indices[i]];
+        }
+        coordinates = std::move(ordered);
+    }
+
+    /// Builds the subtree at node from the points from first to last. Each
+    /// subtree only writes to its own nodes and indices, so the two halves of
+    /// a split can be built at the same time.
+    void Build(const std::size_t node, const std::size_t first, const std::size_t last, const std::size_t threads) {
+        const std::size_t count = last - first;
+        if (count <= leafSize) {
+            nodes[node] = {Scalar{}, leaf, 0, static_cast<std::uint32_t>(first), static_cast<std::uint32_t>(count)};
+            return;
+        }
+
+        // Split the widest extent at the median, so that both halves are the same size.
+        std::array<Scalar, 3> lo;
+        std::array<Scalar, 3> hi;
+        lo.fill(std::numeric_limits<Scalar>::infinity());
+        hi.fill(-std::numeric_limits<Scalar>::infinity());
+        for (std::size_t i = first; i < last; ++i) {
+            const auto& c = coordinates[indices[i]];
+            for (std::size_t d = 0; d < 3; ++d) {
+                lo[d] = std::min(lo[d], c[d]);
+                hi[d] = std::max(hi[d], c[d]);
+            }
+        }
+        std::uint32_t axis = 0;
+        for (std::uint32_t d = 1; d < 3; ++d) {
+            if (hi[d] - lo[d] > hi[axis] - lo[axis]) {
+                axis = d;
+            }
+        }
+
+        const std::size_t middle = first + count / 2;
+        std::nth_element(
+            indices.begin() + first, indices.begin() + middle, indices.begin() + last,
+            [&](const std::uint32_t a, const std::uint32_t b) { return coordinates[a][axis] < coordinates[b][axis]; }
+        );
+        const std::size_t right = node + 1 + NodeCounts(count / 2).first;
+        nodes[node] = {coordinates[indices[middle]][axis], axis, static_cast<std::uint32_t>(right), 0, 0};
+
+        if (threads > 1) {
+            std::jthread worker([this, right, middle, last, threads] { Build(right, middle, last, threads / 2); });
+            Build(node + 1, first, middle, threads - threads / 2);
+        } else {
+            Build(node + 1, first, middle, 1);
+            Build(right, middle, last, 1);
+        }
+    }
+
+    /// Calls visit with the index and squared distance of every point no
+    /// further than the square root of radiusSquared from the query. visit may
+    /// reduce radiusSquared to stop the search going where it is not needed.
+    template <typename Visitor> void Search(const _point& query, Scalar& radiusSquared, Visitor&& visit) const {
+        const std::array<Scalar, 3> q{query.X(), query.Y(), query.Z()};
+
+        // The far side of each split that has been passed, with the squared
+        // distance to the split. The tree is at most 30 levels deep.
+        std::array<std::pair<std::uint32_t, Scalar>, 64> pending;
+        std::size_t top = 0;
+        pending[top++] = {0, Scalar{}};
+        while (top > 0) {
+            const auto [start, splitDistanceSquared] = pending[--top];
+            if (splitDistanceSquared > radiusSquared) {
+                continue;
+            }
+            std::uint32_t index = start;
+            while (nodes[index].axis != leaf) {
+                const Node& node = nodes[index];
+                const Scalar d = q[node.axis] - node.split;
+                pending[top++] = {d < 0 ? node.right : index + 1, d * d};
+                index = d < 0 ? index + 1 : node.right;
+            }
+
+            const Node& node = nodes[index];
+            for (std::size_t i = node.first; i < node.first + node.count; ++i) {
+                const auto& c = coordinates[i];
+                const Scalar dx = c[0] - q[0];
+                const Scalar dy = c[1] - q[1];
+                const Scalar dz = c[2] - q[2];
+                const Scalar distanceSquared = dx * dx + dy * dy + dz * dz;
+                if (distanceSquared <= radiusSquared) {
+                    visit(static_cast<std::size_t>(indices[i]), distanceSquared);
+                }
+            }
+        }
+    }
+
+    std::vector<Node> nodes;
+    std::vector<std::array<Scalar, 3>> coordinates;
+    std::vector<std::uint32_t> indices;
+};
+} // namespace Space::implementation
@@ -0,0 +1,160 @@
+#pragma once
+
+/// This header is kept out of Space.h so that only code which maps files pulls
+/// in the operating system headers.
+
+#include "Space.h"
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Space {
+
+namespace implementation {
+
+/// A read-only view of the whole of a file, which is unmapped when destroyed.
+class FileMapping final {
+  public:
+    explicit FileMapping(const std::filesystem::path& path) {
+#if defined(_WIN32)
+        const HANDLE file =
+            CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "Could not open " + path.string());
+        }
+        // Each error is read before CloseHandle, which may replace it.
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size)) {
+            const auto error = static_cast<int>(GetLastError());
+            CloseHandle(file);
+            throw std::system_error(error, std::system_category(), "Could not find the size of " + path.string());
+        }
+        if (size.QuadPart == 0) {
+            CloseHandle(file);
+            return;
+        }
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const auto mappingError = static_cast<int>(GetLastError());
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            throw std::system_error(mappingError, std::system_category(), "Could not map " + path.string());
+        }
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        const auto viewError = static_cast<int>(GetLastError());
+        CloseHandle(mapping);
+        if (view == nullptr) {
+            throw std::system_error(viewError, std::system_category(), "Could not map " + path.string());
+        }
+        bytes = {static_cast<const std::byte*>(view), static_cast<std::size_t>(size.QuadPart)};
+#else
+        const int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0) {
+            throw std::system_error(errno, std::generic_category(), "Could not open " + path.string());
+        }
+        // Each error is read before close, which may replace errno.
+        struct stat info{};
+        if (::fstat(file, &info) != 0) {
+            const int error = errno;
+            ::close(file);
+            throw std::system_error(error, std::generic_category(), "Could not find the size of " + path.string());
+        }
+        if (info.st_size == 0) {
+            ::close(file);
+            return;
+        }
+        const auto size = static_cast<std::size_t>(info.st_size);
+        void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        const int mapError = errno;
+        ::close(file);
+        if (view == MAP_FAILED) {
+            throw std::system_error(mapError, std::generic_category(), "Could not map " + path.string());
+        }
+        bytes = {static_cast<const std::byte*>(view), size};
+#endif
+    }
+
+    FileMapping(FileMapping&& other) noexcept : bytes(std::exchange(other.bytes, {})) {}
+    FileMapping& operator=(FileMapping&& other) noexcept {
+        if (this != &other) {
+            Unmap();
+            bytes = std::exchange(other.bytes, {});
+        }
+        return *this;
+    }
+    ~FileMapping() { Unmap(); }
+
+    [[nodiscard]] std::span<const std::byte> Bytes() const noexcept { return bytes; }
+
+  private:
+    void Unmap() noexcept {
+        if (bytes.empty()) {
+            return;
+        }
+#if defined(_WIN32)
+        UnmapViewOfFile(bytes.data());
+#else
+        ::munmap(const_cast<std::byte*>(bytes.data()), bytes.size());
+#endif
+    }
+
+    std::span<const std::byte> bytes;
+};
+
+/// Elements which can be used in place in a mapped file. A normalized vector
+/// has to be normalized again when it is read, so it can't be used in place.
+template <typename T>
+concept MappableElement = PackedElement<const T> && IsNotNormalized(BaseTypeOfElement<T>);
+} // namespace implementation
+
+/// A file written by WriteBinary, mapped read-only into memory so that its
+/// elements can be used in place, without being parsed or copied. Opening a
+/// file written for a different space or type throws, in the same way as
+/// ReadBinary. The elements remain valid while the MappedFile exists.
+template <typename T> class MappedFile final {
+    static_assert(
+        implementation::MappableElement<T>,
+        "Only points and vectors which aren't normalized, and whose underlying data is exactly three scalars, can be mapped."
+    );
+
+  public:
+    explicit MappedFile(const std::filesystem::path& path) : mapping(path) {
+        const auto bytes = mapping.Bytes();
+        if (bytes.size() < sizeof(BinaryHeader)) {
+            throw std::invalid_argument("The data ends before the binary header");
+        }
+        BinaryHeader header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        implementation::CheckHeader<T>(header);
+
+        if (header.count > (bytes.size() - sizeof(BinaryHeader)) / sizeof(T)) {
+            throw std::invalid_argument("The data ends before all of its elements");
+        }
+        elements = {reinterpret_cast<const T*>(bytes.data() + sizeof(BinaryHeader)), static_cast<std::size_t>(header.count)};
+    }
+
+    [[nodiscard]] implementation::Span<const T> Elements() const noexcept { return elements; }
+    [[nodiscard]] std::size_t size() const noexcept { return elements.size(); }
+
+  private:
+    implementation::FileMapping mapping;
+    std::span<const T> elements;
+};
+} // namespace Space
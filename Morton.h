@@ -0,0 +1,221 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// The lowest corner of a box, and the scale which takes the box onto the
+/// cells of a Morton code. An axis along which the box is flat has a scale of
+/// zero, so every point is in its first cell.
+template <typename ThisSpace, typename UnderlyingData, BaseType BT>
+[[nodiscard]] static std::pair<std::array<ScalarOf<ThisSpace>, 3>, std::array<ScalarOf<ThisSpace>, 3>>
+MortonFrame(const BoundingBox<ThisSpace, UnderlyingData, BT>& box) {
+    using Scalar = ScalarOf<ThisSpace>;
+    if (box.IsEmpty()) {
+        throw std::invalid_argument("Morton codes need a box which holds at least one point");
+    }
+    constexpr Scalar cells = Is3D(BT) ? Scalar(2097152.0) : Scalar(4294967296.0);
+    const auto lo = box.Min();
+    const auto size = box.Size();
+    std::array<Scalar, 3> corner{lo.X(), lo.Y(), 0};
+    std::array<Scalar, 3> extent{size.X(), size.Y(), 0};
+    if constexpr (Is3D(BT)) {
+        corner[2] = lo.Z();
+        extent[2] = size.Z();
+    }
+    std::array<Scalar, 3> scale{};
+    for (std::size_t d = 0; d < 3; ++d) {
+        scale[d] = extent[d] > 0 ? cells / extent[d] : Scalar{0};
+    }
+    return {corner, scale};
+}
+
+/// The Morton code of a point in a box: the box is divided into 2^21 cells
+/// along each axis for 3D points, or 2^32 for XY points, and the bits of the
+/// cell's coordinates are interleaved, with X lowest. Points which are close
+/// together usually have codes which are close together, so sorting by code
+/// keeps nearby points near each other in memory. Points outside the box have
+/// the code of the nearest cell inside it. Throws if the box is empty.
+template <typename ThisSpace, typename UnderlyingData, BaseType BT>
+[[nodiscard]] std::uint64_t
+MortonCode(const Base<ThisSpace, UnderlyingData, BT>& p, const BoundingBox<ThisSpace, UnderlyingData, BT>& box) {
+    const auto [lo, scale] = MortonFrame(box);
+    std::array<ScalarOf<ThisSpace>, 3> c{p.X(), p.Y(), 0};
+    if constexpr (Is3D(BT)) {
+        c[2] = p.Z();
+    }
+    std::uint64_t code;
+    MortonKernel<ScalarOf<ThisSpace>, Dimensions(BT)>(c.data(), 1, 3, lo.data(), scale.data(), &code);
+    return code;
+}
+
+/// Writes the Morton code of every point in a span to out, a SIMD pack of
+/// points at a time.
+template <typename Element, typename ThisSpace, typename UnderlyingData, BaseType BT>
+requires(std::is_same_v<SpaceOfSpan<Element>, ThisSpace> && BaseTypeOfSpan<Element> == BT)
+void MortonCodes(
+    const Span<Element>& points,
+    const BoundingBox<ThisSpace, UnderlyingData, BT>& box,
+    const std::span<std::uint64_t> out
+) {
+    CheckSizes(points.size(), out.size());
+    const auto [lo, scale] = MortonFrame(box);
+    MortonKernel<ScalarOfSpan<Element>, Dimensions(BT)>(
+        SpanScalars(points), points.size(), strideOf<Element>, lo.data(), scale.data(), out.data()
+    );
+}
+
+/// Sorts the codes, and the order alongside them, with a least significant
+/// digit radix sort a byte at a time. The sort is stable, so elements with the
+/// same code keep their order.
+///
+/// The threads are started once for the whole sort, and wait for each other
+/// between its steps. Each thread first counts all eight bytes of its part of
+/// the codes in one pass, which shows which bytes are the same in every code
+/// so that their passes can be skipped. Each remaining pass then scatters
+/// every thread's part to where its digits go.
+static void RadixSort(std::vector<std::uint64_t>& codes, std::vector<std::size_t>& order) {
+    constexpr std::size_t radix = 256;
+    constexpr std::size_t bytes = sizeof(std::uint64_t);
+    const std::size_t count = codes.size();
+    const std::size_t threads = ThreadsFor(count);
+
+    std::vector<std::uint64_t> codesOut(count);
+    std::vector<std::size_t> orderOut(count);
+    std::vector<std::array<std::array<std::size_t, radix>, bytes>> counts(threads);
+    std::array<bool, bytes> skip{};
+    std::barrier sync(static_cast<std::ptrdiff_t>(threads));
+
+    OnThreads(threads, count, [&](const std::size_t t, const std::size_t first, const std::size_t last) {
+        auto& own = counts[t];
+        for (std::size_t i = first; i < last; ++i) {
+            for (std::size_t byte = 0; byte < bytes; ++byte) {
+                ++own[byte][(codes[i] >> (8 * byte)) & 0xFF];
+            }
+        }
+        sync.arrive_and_wait();
+        if (t == 0) {
+            for (std::size_t byte = 0; byte < bytes; ++byte) {
+                for (std::size_t digit = 0; digit < radix && !skip[byte]; ++digit) {
+                    std::size_t inDigit = 0;
+                    for (const auto& perThread : counts) {
+                        inDigit += perThread[byte][digit];
+                    }
+                    skip[byte] = inDigit == count;
+                }
+            }
+        }
+        sync.arrive_and_wait();
+
+        std::uint64_t* codesIn = codes.data();
+        std::size_t* orderIn = order.data();
+        std::uint64_t* codesTo = codesOut.data();
+        std::size_t* orderTo = orderOut.data();
+        bool counted = true;
+        for (std::size_t byte = 0; byte < bytes; ++byte) {
+            if (skip[byte]) {
+                continue;
+            }
+            auto& next = own[byte];
+            const std::size_t shift = 8 * byte;
+
+            // The first pass uses the counts from the start. After that the
+            // parts hold different codes, so the byte is counted again.
+            if (!std::exchange(counted, false)) {
+                next.fill(0);
+                for (std::size_t i = first; i < last; ++i) {
+                    ++next[(codesIn[i] >> shift) & 0xFF];
+                }
+                sync.arrive_and_wait();
+            }
+
+            // Turn the counts into where each thread writes each digit: all of
+            // the smaller digits come first, and then the same digit from earlier threads.
+            if (t == 0) {
+                std::size_t total = 0;
+                for (std::size_t digit = 0; digit < radix; ++digit) {
+                    for (auto& perThread : counts) {
+                        total += std::exchange(perThread[byte][digit], total);
+                    }
+                }
+            }
+            sync.arrive_and_wait();
+
+            for (std::size_t i = first; i < last; ++i) {
+                const std::size_t to = next[(codesIn[i] >> shift) & 0xFF]++;
+                codesTo[to] = codesIn[i];
+                orderTo[to] = orderIn[i];
+            }
+            std::swap(codesIn, codesTo);
+            std::swap(orderIn, orderTo);
+            sync.arrive_and_wait();
+        }
+    });
+
+    // Each pass moves the elements to the other buffer, so after an odd number
+    // of passes they are in the spare one.
+    if (std::count(skip.begin(), skip.end(), false) % 2 == 1) {
+        codes.swap(codesOut);
+        order.swap(orderOut);
+    }
+}
+
+/// Reorders the points of a span by their Morton codes in the box, so that
+/// points which are close together in space end up close together in
+/// memory. Points with the same code keep their order. Returns the index that
+/// each point had before the sort, so that data kept alongside the points can
+/// be reordered to match.
+///
+/// The points are moved in place by following each cycle of the order, so
+/// only one point at a time is held outside the span.
+template <typename Element, typename ThisSpace, typename UnderlyingData, BaseType BT>
+requires(!std::is_const_v<Element> && std::is_same_v<SpaceOfSpan<Element>, ThisSpace> && BaseTypeOfSpan<Element> == BT)
+std::vector<std::size_t> SortByMorton(const Span<Element>& points, const BoundingBox<ThisSpace, UnderlyingData, BT>& box) {
+    std::vector<std::uint64_t> codes(points.size());
+    MortonCodes(points, box, codes);
+    std::vector<std::size_t> order(points.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    RadixSort(codes, order);
+
+    std::vector<bool> placed(points.size());
+    for (std::size_t start = 0; start < points.size(); ++start) {
+        if (placed[start] || order[start] == start) {
+            continue;
+        }
+        const Element first = points[start];
+        std::size_t to = start;
+        while (order[to] != start) {
+            points[to] = points[order[to]];
+            placed[to] = true;
+            to = order[to];
+        }
+        points[to] = first;
+        placed[to] = true;
+    }
+    return order;
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+template <typename ThisSpace, DifferentSpaceTo<ThisSpace> OtherSpace, typename UnderlyingData, BaseType BT, BaseType OtherBT>
+StaticAssert::invalid_space
+MortonCode(const Base<OtherSpace, UnderlyingData, OtherBT>&, const BoundingBox<ThisSpace, UnderlyingData, BT>&) noexcept {
+    return StaticAssert::invalid_space{};
+}
+template <typename ThisSpace, typename UnderlyingData, BaseType BT, BaseType OtherBT> requires(OtherBT != BT)
+StaticAssert::invalid_bounds_dimensions
+MortonCode(const Base<ThisSpace, UnderlyingData, OtherBT>&, const BoundingBox<ThisSpace, UnderlyingData, BT>&) noexcept {
+    return StaticAssert::invalid_bounds_dimensions{};
+}
+
+template <typename Element, typename ThisSpace, typename UnderlyingData, BaseType BT>
+requires(!std::is_same_v<SpaceOfSpan<Element>, ThisSpace>)
+StaticAssert::invalid_space SortByMorton(const Span<Element>&, const BoundingBox<ThisSpace, UnderlyingData, BT>&) noexcept {
+    return StaticAssert::invalid_space{};
+}
+template <typename Element, typename ThisSpace, typename UnderlyingData, BaseType BT>
+requires(std::is_same_v<SpaceOfSpan<Element>, ThisSpace> && BaseTypeOfSpan<Element> != BT)
+StaticAssert::invalid_bounds_dimensions
+SortByMorton(const Span<Element>&, const BoundingBox<ThisSpace, UnderlyingData, BT>&) noexcept {
+    return StaticAssert::invalid_bounds_dimensions{};
+}
+#endif
+
+} // namespace Space::implementation
@@ -7,87 +7,96 @@ class NormalizedVector final : public Base<ThisSpace, UnderlyingData, BaseType::
     using _base = Base<ThisSpace, UnderlyingData, BaseType::NormalizedVector>;
 
   public:
-    NormalizedVector() {
-        auto iter = implementation::Begin(_base::underlyingData);
-        *iter++ = 1;
-        *iter++ = 0;
-        *iter = 0;
-    }
-    explicit NormalizedVector(const UnderlyingData& v) noexcept(false) {
-        std::copy(implementation::CBegin(v), implementation::CEnd(v), implementation::Begin(_base::underlyingData));
+    using Scalar = typename _base::Scalar;
+
+    constexpr NormalizedVector() noexcept { _base::Assign(1, 0, 0); }
+    constexpr explicit NormalizedVector(const UnderlyingData& v) noexcept(false) {
+        _base::Assign(ComponentOf<Scalar>(v, 0), ComponentOf<Scalar>(v, 1), ComponentOf<Scalar>(v, 2));
         Normalize();
     }
-    NormalizedVector(const double x, const double y, const double z) noexcept(false) {
-        auto iter = implementation::Begin(_base::underlyingData);
-        *iter++ = x;
-        *iter++ = y;
-        *iter = z;
+    constexpr NormalizedVector(const Scalar x, const Scalar y, const Scalar z) noexcept(false) {
+        _base::Assign(x, y, z);
         Normalize();
     }
 
-    [[nodiscard]] operator Vector<ThisSpace, UnderlyingData>() const noexcept {
+    /// Returns an empty optional, rather than throwing, if the vector is too small to normalize.
+    [[nodiscard]] static constexpr std::optional<NormalizedVector>
+    TryMake(const Scalar x, const Scalar y, const Scalar z) noexcept {
+        const Scalar mag = SquareRoot(x * x + y * y + z * z);
+        if (mag < normalizationTolerance) {
+            return std::nullopt;
+        }
+        NormalizedVector n;
+        n.Assign(x / mag, y / mag, z / mag);
+        return n;
+    }
+    [[nodiscard]] static constexpr std::optional<NormalizedVector> TryMake(const UnderlyingData& v) noexcept {
+        return TryMake(ComponentOf<Scalar>(v, 0), ComponentOf<Scalar>(v, 1), ComponentOf<Scalar>(v, 2));
+    }
+
+    [[nodiscard]] constexpr operator Vector<ThisSpace, UnderlyingData>() const noexcept {
         return Vector<ThisSpace, UnderlyingData>(_base::X(), _base::Y(), _base::Z());
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        return std::equal(_base::cbegin(), _base::cend(), implementation::CBegin(UnderlyingDataFrom(other)), Equality);
+    [[nodiscard]] constexpr bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        return _base::EqualTo(UnderlyingDataFrom(other));
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+    [[nodiscard]] constexpr bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
         return !(operator==(other));
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(_base::X(), _base::Y(), _base::Z());
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(_base::X(), _base::Y(), _base::Z());
-        Add(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Add<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
-    [[nodiscard]] auto operator*(const double& d) const noexcept {
+    [[nodiscard]] constexpr auto operator*(const double& d) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(_base::X(), _base::Y(), _base::Z());
-        Scale(UnderlyingDataFrom(v), d);
+        Scale<Scalar>(UnderlyingDataFrom(v), d);
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT) && IsNormalized(BT))
-    auto operator*=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
+    constexpr auto& operator*=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
         *this = this->Cross(rhs);
         return *this;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto operator*(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator*(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         return this->Cross(rhs);
     }
 
     template <BaseType BT> requires(IsVector(BT) && IsNotNormalized(BT))
-    [[nodiscard]] auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        const auto [x, y, z] = Cross_internal(_base::underlyingData, UnderlyingDataFrom(other));
+    [[nodiscard]] constexpr auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        const auto [x, y, z] = Cross_internal<Scalar>(_base::underlyingData, UnderlyingDataFrom(other));
         return Vector<ThisSpace, UnderlyingData>(x, y, z);
     }
 
     template <BaseType BT> requires(IsVector(BT) && IsNormalized(BT))
-    [[nodiscard]] auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        const auto [x, y, z] = Cross_internal(_base::underlyingData, UnderlyingDataFrom(other));
+    [[nodiscard]] constexpr auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        const auto [x, y, z] = Cross_internal<Scalar>(_base::underlyingData, UnderlyingDataFrom(other));
         return NormalizedVector<ThisSpace, UnderlyingData>(x, y, z);
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] double Dot(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        return implementation::Dot(_base::underlyingData, UnderlyingDataFrom(other));
+    [[nodiscard]] constexpr Scalar Dot(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        return implementation::Dot<Scalar>(_base::underlyingData, UnderlyingDataFrom(other));
     }
 
-    [[nodiscard]] auto ToXY() const requires ThisSpace::supportsXY
+    [[nodiscard]] constexpr auto ToXY() const requires ThisSpace::supportsXY
     {
         return NormalizedXYVector<ThisSpace, UnderlyingData>(_base::X(), _base::Y());
     }
@@ -161,13 +170,13 @@ class NormalizedVector final : public Base<ThisSpace, UnderlyingData, BaseType::
 #endif
 
   private:
-    void Normalize() {
-        const auto mag = Mag_internal(_base::underlyingData);
-        if (std::abs(mag) < 1e-6) {
+    constexpr void Normalize() {
+        const auto mag = Mag_internal<Scalar>(_base::underlyingData);
+        if (mag < normalizationTolerance) {
             throw std::invalid_argument("Zero-sized normal vectors are not allowed");
         }
 
-        std::transform(_base::cbegin(), _base::cend(), Begin(_base::underlyingData), [mag](auto v) { return v / mag; });
+        _base::Assign(_base::X() / mag, _base::Y() / mag, ComponentOf<Scalar>(_base::underlyingData, 2) / mag);
     }
 };
 } // namespace Space::implementation
@@ -8,102 +8,106 @@ class NormalizedXYVector final : public Base<ThisSpace, UnderlyingData, BaseType
     using _base = Base<ThisSpace, UnderlyingData, BaseType::NormalizedXYVector>;
 
   public:
-    NormalizedXYVector() noexcept {
-        auto iter = implementation::Begin(_base::underlyingData);
-        *iter++ = 1;
-        *iter++ = 0;
-        *iter = 0;
-    }
-    explicit NormalizedXYVector(const UnderlyingData& v) noexcept(false) {
-        auto iter = implementation::Begin(_base::underlyingData);
-        auto in = implementation::CBegin(v);
-        *iter++ = *in++;
-        *iter++ = *in++;
-        *iter = 0;
+    using Scalar = typename _base::Scalar;
+
+    constexpr NormalizedXYVector() noexcept { _base::Assign(1, 0, 0); }
+    constexpr explicit NormalizedXYVector(const UnderlyingData& v) noexcept(false) {
+        _base::Assign(ComponentOf<Scalar>(v, 0), ComponentOf<Scalar>(v, 1), 0);
         Normalize();
     }
-    NormalizedXYVector(const double x, const double y) noexcept(false) {
-        auto iter = implementation::Begin(_base::underlyingData);
-        *iter++ = x;
-        *iter++ = y;
-        *iter = 0;
+    constexpr NormalizedXYVector(const Scalar x, const Scalar y) noexcept(false) {
+        _base::Assign(x, y, 0);
         Normalize();
     }
 
-    [[nodiscard]] operator Vector<ThisSpace, UnderlyingData>() const noexcept {
+    /// Returns an empty optional, rather than throwing, if the vector is too small to normalize.
+    [[nodiscard]] static constexpr std::optional<NormalizedXYVector> TryMake(const Scalar x, const Scalar y) noexcept {
+        const Scalar mag = SquareRoot(x * x + y * y);
+        if (mag < normalizationTolerance) {
+            return std::nullopt;
+        }
+        NormalizedXYVector n;
+        n.Assign(x / mag, y / mag, 0);
+        return n;
+    }
+    [[nodiscard]] static constexpr std::optional<NormalizedXYVector> TryMake(const UnderlyingData& v) noexcept {
+        return TryMake(ComponentOf<Scalar>(v, 0), ComponentOf<Scalar>(v, 1));
+    }
+
+    [[nodiscard]] constexpr operator Vector<ThisSpace, UnderlyingData>() const noexcept {
         return Vector<ThisSpace, UnderlyingData>(_base::X(), _base::Y(), 0);
     }
 
-    [[nodiscard]] operator XYVector<ThisSpace, UnderlyingData>() const noexcept {
+    [[nodiscard]] constexpr operator XYVector<ThisSpace, UnderlyingData>() const noexcept {
         return XYVector<ThisSpace, UnderlyingData>(_base::X(), _base::Y());
     }
 
-    [[nodiscard]] operator NormalizedVector<ThisSpace, UnderlyingData>() const noexcept {
+    [[nodiscard]] constexpr operator NormalizedVector<ThisSpace, UnderlyingData>() const noexcept {
         return NormalizedVector<ThisSpace, UnderlyingData>(_base::X(), _base::Y(), 0);
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        return std::equal(_base::cbegin(), _base::cend(), implementation::CBegin(UnderlyingDataFrom(other)), Equality);
+    [[nodiscard]] constexpr bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        return _base::EqualTo(UnderlyingDataFrom(other));
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+    [[nodiscard]] constexpr bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
         return !(operator==(other));
     }
 
     template <BaseType BT> requires(IsVector(BT) && Is3D(BT))
-    [[nodiscard]] auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT) && IsXY(BT))
-    [[nodiscard]] auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         XYVector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT) && Is3D(BT))
-    [[nodiscard]] auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Add(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Add<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
     template <BaseType BT> requires(IsVector(BT) && IsXY(BT))
-    [[nodiscard]] auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         XYVector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Add(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Add<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
-    [[nodiscard]] auto operator*(const double& d) const noexcept {
+    [[nodiscard]] constexpr auto operator*(const double& d) const noexcept {
         XYVector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Scale(UnderlyingDataFrom(v), d);
+        Scale<Scalar>(UnderlyingDataFrom(v), d);
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto operator*(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator*(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         return this->Cross(rhs);
     }
 
     template <BaseType BT> requires(IsVector(BT) && IsNotNormalized(BT))
-    [[nodiscard]] auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        const auto [x, y, z] = Cross_internal(_base::underlyingData, UnderlyingDataFrom(other));
+    [[nodiscard]] constexpr auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        const auto [x, y, z] = Cross_internal<Scalar>(_base::underlyingData, UnderlyingDataFrom(other));
         return Vector<ThisSpace, UnderlyingData>(x, y, z);
     }
     template <BaseType BT> requires(IsVector(BT) && IsNormalized(BT))
-    [[nodiscard]] auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        const auto [x, y, z] = Cross_internal(_base::underlyingData, UnderlyingDataFrom(other));
+    [[nodiscard]] constexpr auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        const auto [x, y, z] = Cross_internal<Scalar>(_base::underlyingData, UnderlyingDataFrom(other));
         return NormalizedVector<ThisSpace, UnderlyingData>(x, y, z);
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] double Dot(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        return implementation::Dot(_base::underlyingData, UnderlyingDataFrom(other));
+    [[nodiscard]] constexpr Scalar Dot(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        return implementation::Dot<Scalar>(_base::underlyingData, UnderlyingDataFrom(other));
     }
 
     template <DifferentSpaceTo<ThisSpace> OtherSpace, typename TransformManager>
@@ -171,13 +175,13 @@ class NormalizedXYVector final : public Base<ThisSpace, UnderlyingData, BaseType
 #endif
 
   private:
-    void Normalize() {
-        const auto mag = Mag_internal(_base::underlyingData);
-        if (std::abs(mag) < 1e-6) {
+    constexpr void Normalize() {
+        const auto mag = Mag_internal<Scalar>(_base::underlyingData);
+        if (mag < normalizationTolerance) {
             throw std::invalid_argument("Zero-sized normal vectors are not allowed");
         }
 
-        std::transform(_base::cbegin(), _base::cend(), Begin(_base::underlyingData), [mag](auto v) { return v / mag; });
+        _base::Assign(_base::X() / mag, _base::Y() / mag, ComponentOf<Scalar>(_base::underlyingData, 2) / mag);
     }
 };
 } // namespace Space::implementation
@@ -0,0 +1,421 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// An octree over the points of one space, inside a box fixed when the octree
+/// is made, for data that arrives a little at a time. Points can be inserted
+/// and removed one at a time without a rebuild: a leaf splits into eight when
+/// it holds too many points, and a node merges its children back once they
+/// hold few enough. Nodes come from a pool in blocks of eight siblings, so
+/// splitting and merging reuse memory instead of allocating it.
+///
+/// Points are identified by the id returned from Insert, which stays the same
+/// until the point is removed, after which it may be given to a new point.
+template <typename ThisSpace, typename UnderlyingData> class Octree final {
+    using _point = Point<ThisSpace, UnderlyingData>;
+    using _box = AABB<ThisSpace, UnderlyingData>;
+    using _unit = typename ThisSpace::Unit;
+
+  public:
+    using Scalar = ScalarOf<ThisSpace>;
+    using Neighbour = implementation::Neighbour<Scalar>;
+
+    /// Throws if the bounds are empty.
+    explicit Octree(const _box& bounds) : bounds(bounds), nodes(1) {
+        if (bounds.IsEmpty()) {
+            throw std::invalid_argument("The bounds of an octree must hold at least one point");
+        }
+    }
+
+    [[nodiscard]] const _box& Bounds() const noexcept { return bounds; }
+    [[nodiscard]] std::size_t size() const noexcept { return nodes[root].count; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /// Adds a point and returns its id. Throws if the point is outside the
+    /// bounds of the octree.
+    std::size_t Insert(const _point& p) {
+        if (!bounds.Contains(p)) {
+            throw std::invalid_argument("The point is outside the bounds of the octree");
+        }
+        if (freeIds.empty() && entries.size() == none) {
+            throw std::invalid_argument("An octree can hold at most 4294967294 points");
+        }
+        std::uint32_t id;
+        if (freeIds.empty()) {
+            id = static_cast<std::uint32_t>(entries.size());
+            entries.emplace_back();
+        } else {
+            id = freeIds.back();
+            freeIds.pop_back();
+        }
+        entries[id].position = {p.X(), p.Y(), p.Z()};
+        entries[id].used = true;
+
+        auto [lo, hi] = Corners(bounds);
+        std::uint32_t node = root;
+        std::size_t depth = 0;
+        while (nodes[node].children != none) {
+            ++nodes[node].count;
+            node = nodes[node].children + ChildOf(entries[id].position, lo, hi);
+            ++depth;
+        }
+        ++nodes[node].count;
+        Link(id, node);
+        if (nodes[node].count > leafCapacity && depth < maxDepth) {
+            Split(node, lo, hi, depth);
+        }
+        return id;
+    }
+
+    /// Removes a point, merging nodes whose subtrees become small enough to be
+    /// one leaf.
+    void Remove(const std::size_t id) {
+        if (id >= entries.size() || !entries[id].used) {
+            throw std::invalid_argument("There is no point with this id in the octree");
+        }
+        const auto point = static_cast<std::uint32_t>(id);
+        const std::uint32_t leaf = entries[point].node;
+        Unlink(point);
+        entries[point].used = false;
+        freeIds.push_back(point);
+
+        std::uint32_t merge = none;
+        for (std::uint32_t node = leaf; node != none; node = nodes[node].parent) {
+            --nodes[node].count;
+            if (nodes[node].children != none && nodes[node].count <= leafCapacity) {
+                merge = node;
+            }
+        }
+        if (merge != none) {
+            Merge(merge);
+        }
+    }
+
+    [[nodiscard]] _point Position(const std::size_t id) const {
+        if (id >= entries.size() || !entries[id].used) {
+            throw std::invalid_argument("There is no point with this id in the octree");
+        }
+        const auto& c = entries[id].position;
+        return _point(c[0], c[1], c[2]);
+    }
+
+    /// The ids of every point inside the box, including its surface, in
+    /// ascending order. The results replace the contents of out.
+    void Within(const _box& box, std::vector<std::size_t>& out) const {
+        out.clear();
+        if (box.IsEmpty()) {
+            return;
+        }
+        const auto [lo, hi] = Corners(box);
+        Visit(
+            [&](const std::array<Scalar, 3>& nodeLo, const std::array<Scalar, 3>& nodeHi) {
+                for (std::size_t d = 0; d < 3; ++d) {
+                    if (nodeHi[d] < lo[d] || nodeLo[d] > hi[d]) {
+                        return false;
+                    }
+                }
+                return true;
+            },
+            [&](const std::uint32_t id) {
+                const auto& c = entries[id].position;
+                for (std::size_t d = 0; d < 3; ++d) {
+                    if (c[d] < lo[d] || c[d] > hi[d]) {
+                        return;
+                    }
+                }
+                out.push_back(id);
+            }
+        );
+        std::sort(out.begin(), out.end());
+    }
+
+    [[nodiscard]] std::vector<std::size_t> Within(const _box& box) const {
+        std::vector<std::size_t> out;
+        Within(box, out);
+        return out;
+    }
+
+    /// Every point no further than radius from the query, closest first, with
+    /// the id of each point as its index. The results replace the contents of
+    /// out.
+    void WithinRadius(const _point& query, const _unit& radius, std::vector<Neighbour>& out) const {
+        out.clear();
+        const auto r = static_cast<Scalar>(ValueOfUnit(radius));
+        if (r < 0) {
+            return;
+        }
+        const std::array<Scalar, 3> q{query.X(), query.Y(), query.Z()};
+        const Scalar radiusSquared = r * r;
+        Visit(
+            [&](const std::array<Scalar, 3>& nodeLo, const std::array<Scalar, 3>& nodeHi) {
+                // The squared distance from the query to the closest point of the node.
+                Scalar distanceSquared = 0;
+                for (std::size_t d = 0; d < 3; ++d) {
+                    const Scalar outside = std::max({nodeLo[d] - q[d], Scalar{0}, q[d] - nodeHi[d]});
+                    distanceSquared += outside * outside;
+                }
+                return distanceSquared <= radiusSquared;
+            },
+            [&](const std::uint32_t id) {
+                const auto& c = entries[id].position;
+                const Scalar dx = c[0] - q[0];
+                const Scalar dy = c[1] - q[1];
+                const Scalar dz = c[2] - q[2];
+                const Scalar distanceSquared = dx * dx + dy * dy + dz * dz;
+                if (distanceSquared <= radiusSquared) {
+                    out.push_back({id, distanceSquared});
+                }
+            }
+        );
+        std::sort(out.begin(), out.end(), Closer<Scalar>);
+        for (auto& neighbour : out) {
+            neighbour.distance = std::sqrt(neighbour.distance);
+        }
+    }
+
+    [[nodiscard]] std::vector<Neighbour> WithinRadius(const _point& query, const _unit& radius) const {
+        std::vector<Neighbour> out;
+        WithinRadius(query, radius, out);
+        return out;
+    }
+
+    /// Calls visit with the bounds and the point ids of each leaf that holds
+    /// any points, in Morton order, so that leaves which are close together in
+    /// space are mostly visited close together in time.
+    template <typename Visitor> void VisitLeaves(Visitor&& visit) const {
+        std::vector<std::size_t> ids;
+        const auto [lo, hi] = Corners(bounds);
+        VisitLeaves(root, lo, hi, ids, visit);
+    }
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space Insert(const Base<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType, typename... Args>
+    StaticAssert::invalid_space Within(const BoundingBox<OtherSpace, UnderlyingData, OtherBaseType>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType, typename... Args>
+    StaticAssert::invalid_space WithinRadius(const Base<OtherSpace, UnderlyingData, OtherBaseType>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+
+    template <BaseType OtherBaseType> requires(OtherBaseType != BaseType::Point)
+    StaticAssert::invalid_spatial_query Insert(const Base<ThisSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_spatial_query{};
+    }
+    template <BaseType OtherBaseType, typename... Args> requires(OtherBaseType != BaseType::Point)
+    StaticAssert::invalid_spatial_query
+    WithinRadius(const Base<ThisSpace, UnderlyingData, OtherBaseType>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_spatial_query{};
+    }
+#endif
+
+  private:
+    static constexpr std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::uint32_t root = 0;
+    static constexpr std::uint32_t leafCapacity = 16;
+    /// A leaf at this depth is 2^21 times narrower than the octree, so the path
+    /// to any leaf fits in a 63-bit Morton code.
+    static constexpr std::size_t maxDepth = 21;
+
+    /// count is the number of points in the subtree. A leaf keeps its points
+    /// in a list which starts at head, and other nodes have eight children
+    /// which are next to each other in the pool, from children onwards.
+    struct Node final {
+        std::uint32_t parent = none;
+        std::uint32_t children = none;
+        std::uint32_t head = none;
+        std::uint32_t count = 0;
+    };
+
+    /// Each point is in the list of its leaf, linked through previous and next.
+    struct Entry final {
+        std::array<Scalar, 3> position{};
+        std::uint32_t node = none;
+        std::uint32_t previous = none;
+        std::uint32_t next = none;
+        bool used = false;
+    };
+
+    using Corner = std::array<Scalar, 3>;
+
+    [[nodiscard]] static std::pair<Corner, Corner> Corners(const _box& box) noexcept {
+        const auto lo = box.Min();
+        const auto hi = box.Max();
+        return {{lo.X(), lo.Y(), lo.Z()}, {hi.X(), hi.Y(), hi.Z()}};
+    }
+
+    /// The child of the node from lo to hi which holds position, with the
+    /// bits of the child's index from X, Y and Z so that the children are in
+    /// Morton order. lo and hi become the bounds of that child.
+    [[nodiscard]] static std::uint32_t ChildOf(const Corner& position, Corner& lo, Corner& hi) noexcept {
+        std::uint32_t child = 0;
+        for (std::size_t d = 0; d < 3; ++d) {
+            const Scalar middle = lo[d] + (hi[d] - lo[d]) / 2;
+            if (position[d] >= middle) {
+                child |= 1u << d;
+                lo[d] = middle;
+            } else {
+                hi[d] = middle;
+            }
+        }
+        return child;
+    }
+
+    [[nodiscard]] static std::pair<Corner, Corner>
+    ChildBounds(const Corner& lo, const Corner& hi, const std::uint32_t child) noexcept {
+        Corner childLo;
+        Corner childHi;
+        for (std::size_t d = 0; d < 3; ++d) {
+            const Scalar middle = lo[d] + (hi[d] - lo[d]) / 2;
+            const bool upper = (child >> d) & 1u;
+            childLo[d] = upper ? middle : lo[d];
+            childHi[d] = upper ? hi[d] : middle;
+        }
+        return {childLo, childHi};
+    }
+
+    void Link(const std::uint32_t id, const std::uint32_t node) noexcept {
+        Entry& entry = entries[id];
+        entry.node = node;
+        entry.previous = none;
+        entry.next = nodes[node].head;
+        if (entry.next != none) {
+            entries[entry.next].previous = id;
+        }
+        nodes[node].head = id;
+    }
+
+    void Unlink(const std::uint32_t id) noexcept {
+        const Entry& entry = entries[id];
+        if (entry.previous != none) {
+            entries[entry.previous].next = entry.next;
+        } else {
+            nodes[entry.node].head = entry.next;
+        }
+        if (entry.next != none) {
+            entries[entry.next].previous = entry.previous;
+        }
+    }
+
+    /// Takes eight siblings from the pool, reusing a freed block if there is one.
+    [[nodiscard]] std::uint32_t AllocateChildren(const std::uint32_t parent) {
+        std::uint32_t first;
+        if (freeBlocks.empty()) {
+            if (nodes.size() > none - 8) {
+                throw std::invalid_argument("An octree can hold at most 4294967287 nodes");
+            }
+            first = static_cast<std::uint32_t>(nodes.size());
+            nodes.resize(nodes.size() + 8);
+        } else {
+            first = freeBlocks.back();
+            freeBlocks.pop_back();
+        }
+        for (std::uint32_t c = 0; c < 8; ++c) {
+            nodes[first + c] = Node{parent, none, none, 0};
+        }
+        return first;
+    }
+
+    /// Moves the points of a leaf into eight new children, and splits any of
+    /// those which still hold too many.
+    void Split(const std::uint32_t node, const Corner& lo, const Corner& hi, const std::size_t depth) {
+        const std::uint32_t children = AllocateChildren(node);
+        nodes[node].children = children;
+        for (std::uint32_t id = std::exchange(nodes[node].head, none); id != none;) {
+            const std::uint32_t next = entries[id].next;
+            Corner childLo = lo;
+            Corner childHi = hi;
+            const std::uint32_t child = children + ChildOf(entries[id].position, childLo, childHi);
+            ++nodes[child].count;
+            Link(id, child);
+            id = next;
+        }
+        for (std::uint32_t c = 0; c < 8; ++c) {
+            if (nodes[children + c].count > leafCapacity && depth + 1 < maxDepth) {
+                const auto [childLo, childHi] = ChildBounds(lo, hi, c);
+                Split(children + c, childLo, childHi, depth + 1);
+            }
+        }
+    }
+
+    /// Moves every point below the node into the node's own list, and returns
+    /// the blocks of its descendants to the pool.
+    void Merge(const std::uint32_t node) {
+        const std::uint32_t children = std::exchange(nodes[node].children, none);
+        for (std::uint32_t c = 0; c < 8; ++c) {
+            const std::uint32_t child = children + c;
+            if (nodes[child].children != none) {
+                Merge(child);
+            }
+            for (std::uint32_t id = nodes[child].head; id != none;) {
+                const std::uint32_t next = entries[id].next;
+                Link(id, node);
+                id = next;
+            }
+        }
+        freeBlocks.push_back(children);
+    }
+
+    /// Calls visitPoint for each point in the leaves below nodes for which
+    /// enter returns true, given the bounds of the node.
+    template <typename Enter, typename VisitPoint> void Visit(Enter&& enter, VisitPoint&& visitPoint) const {
+        const auto [lo, hi] = Corners(bounds);
+        Visit(root, lo, hi, enter, visitPoint);
+    }
+
+    template <typename Enter, typename VisitPoint>
+    void Visit(const std::uint32_t node, const Corner& lo, const Corner& hi, Enter& enter, VisitPoint& visitPoint) const {
+        if (nodes[node].count == 0 || !enter(lo, hi)) {
+            return;
+        }
+        if (nodes[node].children == none) {
+            for (std::uint32_t id = nodes[node].head; id != none; id = entries[id].next) {
+                visitPoint(id);
+            }
+            return;
+        }
+        for (std::uint32_t c = 0; c < 8; ++c) {
+            const auto [childLo, childHi] = ChildBounds(lo, hi, c);
+            Visit(nodes[node].children + c, childLo, childHi, enter, visitPoint);
+        }
+    }
+
+    template <typename Visitor>
+    void VisitLeaves(
+        const std::uint32_t node,
+        const Corner& lo,
+        const Corner& hi,
+        std::vector<std::size_t>& ids,
+        Visitor& visit
+    ) const {
+        if (nodes[node].count == 0) {
+            return;
+        }
+        if (nodes[node].children == none) {
+            ids.clear();
+            for (std::uint32_t id = nodes[node].head; id != none; id = entries[id].next) {
+                ids.push_back(id);
+            }
+            std::sort(ids.begin(), ids.end());
+            visit(
+                _box(_point(lo[0], lo[1], lo[2]), _point(hi[0], hi[1], hi[2])), std::span<const std::size_t>(ids)
+            );
+            return;
+        }
+        for (std::uint32_t c = 0; c < 8; ++c) {
+            const auto [childLo, childHi] = ChildBounds(lo, hi, c);
+            VisitLeaves(nodes[node].children + c, childLo, childHi, ids, visit);
+        }
+    }
+
+    _box bounds;
+    std::vector<Node> nodes;
+    std::vector<std::uint32_t> freeBlocks;
+    std::vector<Entry> entries;
+    std::vector<std::uint32_t> freeIds;
+};
+} // namespace Space::implementation
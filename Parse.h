@@ -0,0 +1,100 @@
+#pragma once
+
+namespace Space {
+
+namespace implementation {
+
+[[nodiscard]] static constexpr std::string_view SkipSpaces(const std::string_view text) noexcept {
+    const auto first = text.find_first_not_of(" \t\r");
+    return first == std::string_view::npos ? std::string_view{} : text.substr(first);
+}
+
+/// Removes prefix from the start of text, or returns false if text does not start with it.
+[[nodiscard]] static constexpr bool Consume(std::string_view& text, const std::string_view prefix) noexcept {
+    if (!text.starts_with(prefix)) {
+        return false;
+    }
+    text.remove_prefix(prefix.size());
+    return true;
+}
+
+template <typename Scalar> [[nodiscard]] static bool ConsumeScalar(std::string_view& text, Scalar& value) noexcept {
+    text = SkipSpaces(text);
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{}) {
+        return false;
+    }
+    text.remove_prefix(static_cast<std::size_t>(end - text.data()));
+    return true;
+}
+
+template <typename T> [[nodiscard]] std::optional<T> ParseElement(std::string_view text) noexcept {
+    using _space = decltype(SpaceTypeOf(std::declval<const T&>()));
+    constexpr BaseType BT = decltype(BaseTypeOf(std::declval<const T&>()))::value;
+    using Scalar = typename T::Scalar;
+
+    text = SkipSpaces(text);
+    if (!Consume(text, SpaceTypeNameMap<_space>::name) || !Consume(text, "::") || !Consume(text, Name(BT)) ||
+        !Consume(text, " (")) {
+        return std::nullopt;
+    }
+    std::array<Scalar, 3> values{};
+    for (int i = 0; i < Dimensions(BT); ++i) {
+        if ((i > 0 && !Consume(text, ",")) || !ConsumeScalar(text, values[i])) {
+            return std::nullopt;
+        }
+    }
+    text = SkipSpaces(text);
+    if (!Consume(text, ")") || !SkipSpaces(text).empty()) {
+        return std::nullopt;
+    }
+
+    if constexpr (IsNormalized(BT) && Is3D(BT)) {
+        return T::TryMake(values[0], values[1], values[2]);
+    } else if constexpr (IsNormalized(BT)) {
+        return T::TryMake(values[0], values[1]);
+    } else if constexpr (Is3D(BT)) {
+        return T(values[0], values[1], values[2]);
+    } else {
+        return T(values[0], values[1]);
+    }
+}
+} // namespace implementation
+
+/// Reads a point or vector in the form written by operator<< and the default
+/// format, such as "View::Point (1, 2, 3)". Returns an empty optional if the
+/// text names a different space or type, is not in that form, or holds a
+/// normalized vector that is too small to normalize.
+template <typename T> [[nodiscard]] std::optional<T> Parse(const std::string_view text) noexcept {
+    return implementation::ParseElement<T>(text);
+}
+
+/// Parses one point or vector per line of text, and appends them to out.
+/// Blank lines are skipped. Throws if any other line cannot be parsed, in
+/// which case the elements before it have already been appended. Returns the
+/// number of elements appended.
+template <typename Container> std::size_t ParseAll(std::string_view text, Container& out) {
+    using T = typename Container::value_type;
+    if constexpr (requires { out.reserve(out.size()); }) {
+        out.reserve(out.size() + static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n')) + 1);
+    }
+
+    std::size_t parsed = 0;
+    for (std::size_t line = 1; !text.empty(); ++line) {
+        const auto end = text.find('\n');
+        const auto current = text.substr(0, end);
+        text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+        if (implementation::SkipSpaces(current).empty()) {
+            continue;
+        }
+
+        const auto element = implementation::ParseElement<T>(current);
+        if (!element) {
+            throw std::invalid_argument(std::format("Line {} could not be parsed", line));
+        }
+        out.push_back(*element);
+        ++parsed;
+    }
+    return parsed;
+}
+} // namespace Space
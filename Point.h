@@ -7,59 +7,56 @@ class Point final : public Base<ThisSpace, UnderlyingData, BaseType::Point> {
     using _base = Base<ThisSpace, UnderlyingData, BaseType::Point>;
 
   public:
-    Point() noexcept { std::fill(_base::begin(), _base::end(), 0); }
+    using Scalar = typename _base::Scalar;
 
-    explicit Point(const UnderlyingData& v) noexcept {
-        std::copy(implementation::CBegin(v), implementation::CEnd(v), _base::begin());
-    }
+    constexpr Point() noexcept { _base::Assign(0, 0, 0); }
 
-    Point(const double x, const double y, const double z) noexcept {
-        auto iter = _base::begin();
-        *iter++ = x;
-        *iter++ = y;
-        *iter = z;
+    constexpr explicit Point(const UnderlyingData& v) noexcept {
+        _base::Assign(ComponentOf<Scalar>(v, 0), ComponentOf<Scalar>(v, 1), ComponentOf<Scalar>(v, 2));
     }
 
+    constexpr Point(const Scalar x, const Scalar y, const Scalar z) noexcept { _base::Assign(x, y, z); }
+
     template <BaseType BT> requires(IsPoint(BT))
-    [[nodiscard]] bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        return std::equal(_base::cbegin(), _base::cend(), implementation::CBegin(static_cast<UnderlyingData>(other)), Equality);
+    [[nodiscard]] constexpr bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        return _base::EqualTo(UnderlyingDataFrom(other));
     }
 
     template <BaseType BT> requires(IsPoint(BT))
-    [[nodiscard]] bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+    [[nodiscard]] constexpr bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
         return !(operator==(other));
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    auto operator-=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
-        Sub(_base::underlyingData, UnderlyingDataFrom(rhs));
+    constexpr auto& operator-=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
+        Sub<Scalar>(_base::underlyingData, UnderlyingDataFrom(rhs));
         return *this;
     }
 
     template <BaseType BT> requires(IsPoint(BT))
-    [[nodiscard]] auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(_base::X(), _base::Y(), _base::Z());
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Point<ThisSpace, UnderlyingData> v(_base::X(), _base::Y(), _base::Z());
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    auto operator+=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
-        Add(_base::underlyingData, UnderlyingDataFrom(rhs));
+    constexpr auto& operator+=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
+        Add<Scalar>(_base::underlyingData, UnderlyingDataFrom(rhs));
         return *this;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Point<ThisSpace, UnderlyingData> p(_base::X(), _base::Y(), _base::Z());
-        Add(UnderlyingDataFrom(p), UnderlyingDataFrom(rhs));
+        Add<Scalar>(UnderlyingDataFrom(p), UnderlyingDataFrom(rhs));
         return p;
     }
 
@@ -70,7 +67,7 @@ class Point final : public Base<ThisSpace, UnderlyingData, BaseType::Point> {
         );
     }
 
-    [[nodiscard]] auto ToXY() const requires ThisSpace::supportsXY
+    [[nodiscard]] constexpr auto ToXY() const requires ThisSpace::supportsXY
     {
         return XYPoint<ThisSpace, UnderlyingData>(_base::X(), _base::Y());
     }
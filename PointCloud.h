@@ -0,0 +1,467 @@
+#pragma once
+
+namespace Space::implementation {
+
+template <typename ThisSpace, typename UnderlyingData, BaseType BT> struct CloudValue;
+
+template <typename ThisSpace, typename UnderlyingData> struct CloudValue<ThisSpace, UnderlyingData, BaseType::Point> {
+    using type = Point<ThisSpace, UnderlyingData>;
+};
+
+template <typename ThisSpace, typename UnderlyingData> struct CloudValue<ThisSpace, UnderlyingData, BaseType::Vector> {
+    using type = Vector<ThisSpace, UnderlyingData>;
+};
+
+template <typename ThisSpace, typename UnderlyingData> struct CloudValue<ThisSpace, UnderlyingData, BaseType::XYPoint> {
+    using type = XYPoint<ThisSpace, UnderlyingData>;
+};
+
+template <typename ThisSpace, typename UnderlyingData> struct CloudValue<ThisSpace, UnderlyingData, BaseType::XYVector> {
+    using type = XYVector<ThisSpace, UnderlyingData>;
+};
+
+/// Converting an XY element to another space gives a 3D element, as it does
+/// for a single XYPoint or XYVector.
+static consteval BaseType ConvertedBaseType(BaseType BT) {
+    if (Is3D(BT)) {
+        return BT;
+    }
+    return IsPoint(BT) ? BaseType::Point : BaseType::Vector;
+}
+
+template <typename ThisSpace, typename UnderlyingData, BaseType BT> class Cloud;
+template <typename ThisSpace, typename UnderlyingData, BaseType BT> class CloudReference;
+
+template <typename T> [[nodiscard]] const T& ValueOf(const T& t) noexcept { return t; }
+
+template <typename S, typename U, BaseType B>
+[[nodiscard]] typename CloudValue<S, U, B>::type ValueOf(const CloudReference<S, U, B>& r) noexcept {
+    return r.Get();
+}
+
+/// A typed handle onto one element of a Cloud. Reads gather the element from
+/// the columns, writes scatter it back, so it behaves like the Point or Vector
+/// it refers to.
+template <typename ThisSpace, typename UnderlyingData, BaseType BT> class CloudReference final {
+    using _cloud = Cloud<ThisSpace, UnderlyingData, BT>;
+    using _value = typename CloudValue<ThisSpace, UnderlyingData, BT>::type;
+
+  public:
+    using Scalar = ScalarOf<ThisSpace>;
+
+    CloudReference(_cloud& cloud, const std::size_t index) noexcept : cloud(cloud), index(index) {}
+    CloudReference(const CloudReference&) noexcept = default;
+
+    CloudReference& operator=(const _value& v) noexcept {
+        cloud.Store(index, v);
+        return *this;
+    }
+    CloudReference& operator=(const CloudReference& other) noexcept { return operator=(other.Get()); }
+
+    [[nodiscard]] operator _value() const noexcept { return Get(); }
+    [[nodiscard]] _value Get() const noexcept { return cloud.Load(index); }
+
+    [[nodiscard]] Scalar X() const noexcept { return cloud.columns[0][index]; }
+    [[nodiscard]] Scalar Y() const noexcept { return cloud.columns[1][index]; }
+    [[nodiscard]] Scalar Z() const noexcept requires(Is3D(BT))
+    {
+        return cloud.columns[2][index];
+    }
+
+    void SetX(const Scalar d) noexcept { cloud.columns[0][index] = d; }
+    void SetY(const Scalar d) noexcept { cloud.columns[1][index] = d; }
+    void SetZ(const Scalar d) noexcept requires(Is3D(BT))
+    {
+        cloud.columns[2][index] = d;
+    }
+
+    template <typename T> [[nodiscard]] auto operator==(const T& rhs) const noexcept -> decltype(Get() == ValueOf(rhs)) {
+        return Get() == ValueOf(rhs);
+    }
+    template <typename T> [[nodiscard]] auto operator!=(const T& rhs) const noexcept -> decltype(Get() != ValueOf(rhs)) {
+        return Get() != ValueOf(rhs);
+    }
+    template <typename T> [[nodiscard]] auto operator+(const T& rhs) const noexcept -> decltype(Get() + ValueOf(rhs)) {
+        return Get() + ValueOf(rhs);
+    }
+    template <typename T> [[nodiscard]] auto operator-(const T& rhs) const noexcept -> decltype(Get() - ValueOf(rhs)) {
+        return Get() - ValueOf(rhs);
+    }
+    template <typename T> [[nodiscard]] auto operator*(const T& rhs) const noexcept -> decltype(Get() * ValueOf(rhs)) {
+        return Get() * ValueOf(rhs);
+    }
+    template <typename T> [[nodiscard]] auto Dot(const T& rhs) const noexcept -> decltype(Get().Dot(ValueOf(rhs))) {
+        return Get().Dot(ValueOf(rhs));
+    }
+    template <typename T> [[nodiscard]] auto Cross(const T& rhs) const noexcept -> decltype(Get().Cross(ValueOf(rhs))) {
+        return Get().Cross(ValueOf(rhs));
+    }
+
+    [[nodiscard]] auto Mag() const noexcept requires(IsVector(BT))
+    {
+        return Get().Mag();
+    }
+    [[nodiscard]] double Mag_double() const noexcept requires(IsVector(BT))
+    {
+        return Get().Mag_double();
+    }
+    [[nodiscard]] auto Norm() const requires(IsVector(BT))
+    {
+        return Get().Norm();
+    }
+
+    template <BaseType RBT> requires(IsVector(RBT))
+    CloudReference& operator+=(const Base<ThisSpace, UnderlyingData, RBT>& rhs) noexcept {
+        return operator=(Get() + rhs);
+    }
+
+    template <BaseType RBT> requires(IsVector(RBT))
+    CloudReference& operator-=(const Base<ThisSpace, UnderlyingData, RBT>& rhs) noexcept {
+        return operator=(Get() - rhs);
+    }
+
+    CloudReference& operator*=(const double& d) noexcept requires(IsVector(BT))
+    {
+        return operator=(Get() * d);
+    }
+
+    template <BaseType RBT> requires(IsVector(BT) && IsVector(RBT))
+    CloudReference& operator*=(const Base<ThisSpace, UnderlyingData, RBT>& rhs) noexcept {
+        return operator=(Get().Cross(rhs));
+    }
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space operator+=(const Base<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space operator-=(const Base<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space operator*=(const Base<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+
+    template <BaseType RBT> requires(IsPoint(BT) && IsPoint(RBT))
+    StaticAssert::invalid_point_to_point_addition operator+=(const Base<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_point_to_point_addition{};
+    }
+    template <BaseType RBT> requires(IsPoint(BT) && IsPoint(RBT))
+    StaticAssert::invalid_point_from_point_subtraction operator-=(const Base<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_point_from_point_subtraction{};
+    }
+#endif
+
+  private:
+    _cloud& cloud;
+    std::size_t index;
+};
+
+template <typename CloudType, typename Reference> class CloudIterator final {
+  public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename std::remove_const_t<CloudType>::value_type;
+
+    CloudIterator() noexcept = default;
+    CloudIterator(CloudType* cloud, const std::size_t index) noexcept : cloud(cloud), index(index) {}
+
+    [[nodiscard]] Reference operator*() const noexcept { return (*cloud)[index]; }
+
+    CloudIterator& operator++() noexcept {
+        ++index;
+        return *this;
+    }
+    CloudIterator operator++(int) noexcept {
+        auto copy = *this;
+        ++index;
+        return copy;
+    }
+
+    [[nodiscard]] bool operator==(const CloudIterator& other) const noexcept = default;
+
+  private:
+    CloudType* cloud = nullptr;
+    std::size_t index = 0;
+};
+
+/// Structure-of-arrays storage for many points or vectors of one space. Each
+/// coordinate lives in its own contiguous column, so bulk operations stream
+/// through memory and can be vectorized by the compiler. XY clouds only have
+/// x and y columns, so each element takes two values rather than three.
+template <typename ThisSpace, typename UnderlyingData, BaseType BT> class Cloud final {
+    using _value = typename CloudValue<ThisSpace, UnderlyingData, BT>::type;
+
+  public:
+    using Scalar = ScalarOf<ThisSpace>;
+    using value_type = _value;
+    using reference = CloudReference<ThisSpace, UnderlyingData, BT>;
+    using iterator = CloudIterator<Cloud, reference>;
+    using const_iterator = CloudIterator<const Cloud, _value>;
+
+    Cloud() noexcept = default;
+    explicit Cloud(const std::size_t count) { resize(count); }
+    Cloud(std::initializer_list<_value> values) {
+        reserve(values.size());
+        for (const auto& v : values) {
+            push_back(v);
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return columns[0].size(); }
+    [[nodiscard]] bool empty() const noexcept { return columns[0].empty(); }
+    [[nodiscard]] std::size_t capacity() const noexcept { return columns[0].capacity(); }
+
+    void reserve(const std::size_t count) {
+        for (auto& column : columns) {
+            column.reserve(count);
+        }
+    }
+    void resize(const std::size_t count) {
+        for (auto& column : columns) {
+            column.resize(count);
+        }
+    }
+    void clear() noexcept {
+        for (auto& column : columns) {
+            column.clear();
+        }
+    }
+
+    void push_back(const _value& v) {
+        auto in = v.cbegin();
+        for (auto& column : columns) {
+            column.push_back(*in++);
+        }
+    }
+
+    [[nodiscard]] reference operator[](const std::size_t i) noexcept { return reference(*this, i); }
+    [[nodiscard]] _value operator[](const std::size_t i) const noexcept { return Load(i); }
+
+    [[nodiscard]] iterator begin() noexcept { return iterator(this, 0); }
+    [[nodiscard]] iterator end() noexcept { return iterator(this, size()); }
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator(this, size()); }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+    [[nodiscard]] std::span<Scalar> Xs() noexcept { return columns[0]; }
+    [[nodiscard]] std::span<Scalar> Ys() noexcept { return columns[1]; }
+    [[nodiscard]] std::span<Scalar> Zs() noexcept requires(Is3D(BT))
+    {
+        return columns[2];
+    }
+    [[nodiscard]] std::span<const Scalar> Xs() const noexcept { return columns[0]; }
+    [[nodiscard]] std::span<const Scalar> Ys() const noexcept { return columns[1]; }
+    [[nodiscard]] std::span<const Scalar> Zs() const noexcept requires(Is3D(BT))
+    {
+        return columns[2];
+    }
+
+    template <BaseType RBT> requires(IsVector(RBT) && (Is3D(BT) || IsXY(RBT)))
+    Cloud& operator+=(const Base<ThisSpace, UnderlyingData, RBT>& rhs) noexcept {
+        auto offset = rhs.cbegin();
+        for (int c = 0; c < Dimensions(RBT); ++c) {
+            const Scalar d = *offset++;
+            std::transform(columns[c].cbegin(), columns[c].cend(), columns[c].begin(), [d](auto v) { return v + d; });
+        }
+        return *this;
+    }
+
+    template <BaseType RBT> requires(IsVector(RBT) && (Is3D(BT) || IsXY(RBT)))
+    Cloud& operator-=(const Base<ThisSpace, UnderlyingData, RBT>& rhs) noexcept {
+        auto offset = rhs.cbegin();
+        for (int c = 0; c < Dimensions(RBT); ++c) {
+            const Scalar d = *offset++;
+            std::transform(columns[c].cbegin(), columns[c].cend(), columns[c].begin(), [d](auto v) { return v - d; });
+        }
+        return *this;
+    }
+
+    template <BaseType RBT> requires(IsVector(RBT) && (Is3D(BT) || IsXY(RBT)))
+    Cloud& operator+=(const Cloud<ThisSpace, UnderlyingData, RBT>& rhs) {
+        CheckSameSize(rhs);
+        for (int d = 0; d < Dimensions(RBT); ++d) {
+            std::transform(columns[d].cbegin(), columns[d].cend(), rhs.columns[d].cbegin(), columns[d].begin(), std::plus<>());
+        }
+        return *this;
+    }
+
+    template <BaseType RBT> requires(IsVector(RBT) && (Is3D(BT) || IsXY(RBT)))
+    Cloud& operator-=(const Cloud<ThisSpace, UnderlyingData, RBT>& rhs) {
+        CheckSameSize(rhs);
+        for (int d = 0; d < Dimensions(RBT); ++d) {
+            std::transform(columns[d].cbegin(), columns[d].cend(), rhs.columns[d].cbegin(), columns[d].begin(), std::minus<>());
+        }
+        return *this;
+    }
+
+    Cloud& operator*=(const double& d) noexcept requires(IsVector(BT))
+    {
+        for (auto& column : columns) {
+            std::transform(column.cbegin(), column.cend(), column.begin(), [d](auto v) { return v * d; });
+        }
+        return *this;
+    }
+
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, typename TransformManager>
+    [[nodiscard]] auto ConvertTo(const TransformManager& transform_manager) const {
+        constexpr BaseType convertedBT = ConvertedBaseType(BT);
+        Cloud<OtherSpace, UnderlyingData, convertedBT> converted(size());
+
+        // Gather a block of elements at a time so that the transform manager
+        // can convert them in one call. XY elements are only widened to the
+        // full UnderlyingData here, with a zero z.
+        constexpr std::size_t blockSize = 256;
+        std::array<UnderlyingData, blockSize> in;
+        std::array<UnderlyingData, blockSize> out;
+        if constexpr (IsXY(BT)) {
+            for (auto& u : in) {
+                SetComponent<Scalar>(u, 2, 0);
+            }
+        }
+        for (std::size_t first = 0; first < size(); first += blockSize) {
+            const auto count = std::min(blockSize, size() - first);
+            for (int d = 0; d < Dimensions(BT); ++d) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    SetComponent<Scalar>(in[i], d, columns[d][first + i]);
+                }
+            }
+            Transform<ThisSpace, OtherSpace, BT>(
+                transform_manager, std::span<const UnderlyingData>(in.data(), count), std::span<UnderlyingData>(out.data(), count)
+            );
+            for (int d = 0; d < Dimensions(convertedBT); ++d) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    converted.columns[d][first + i] = ComponentOf<Scalar>(out[i], d);
+                }
+            }
+        }
+        return converted;
+    }
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space operator+=(const Base<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space operator-=(const Base<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space operator+=(const Cloud<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space operator-=(const Cloud<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+
+    template <BaseType RBT> requires(IsPoint(BT) && IsPoint(RBT))
+    StaticAssert::invalid_point_to_point_addition operator+=(const Base<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_point_to_point_addition{};
+    }
+    template <BaseType RBT> requires(IsPoint(BT) && IsPoint(RBT))
+    StaticAssert::invalid_point_to_point_addition operator+=(const Cloud<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_point_to_point_addition{};
+    }
+    template <BaseType RBT> requires(IsPoint(BT) && IsPoint(RBT))
+    StaticAssert::invalid_point_from_point_subtraction operator-=(const Base<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_point_from_point_subtraction{};
+    }
+    template <BaseType RBT> requires(IsPoint(BT) && IsPoint(RBT))
+    StaticAssert::invalid_point_from_point_subtraction operator-=(const Cloud<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_point_from_point_subtraction{};
+    }
+    template <BaseType RBT> requires(IsVector(BT) && IsPoint(RBT))
+    StaticAssert::invalid_point_to_vector_addition operator+=(const Base<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_point_to_vector_addition{};
+    }
+    template <BaseType RBT> requires(IsVector(BT) && IsPoint(RBT))
+    StaticAssert::invalid_point_to_vector_addition operator+=(const Cloud<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_point_to_vector_addition{};
+    }
+    template <BaseType RBT> requires(IsVector(BT) && IsPoint(RBT))
+    StaticAssert::invalid_point_from_vector_subtraction operator-=(const Base<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_point_from_vector_subtraction{};
+    }
+    template <BaseType RBT> requires(IsVector(BT) && IsPoint(RBT))
+    StaticAssert::invalid_point_from_vector_subtraction operator-=(const Cloud<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_point_from_vector_subtraction{};
+    }
+
+    template <BaseType RBT> requires(IsXY(BT) && IsPoint(BT) && IsVector(RBT) && Is3D(RBT))
+    StaticAssert::invalid_vector3_to_xy_point_addition operator+=(const Base<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_vector3_to_xy_point_addition{};
+    }
+    template <BaseType RBT> requires(IsXY(BT) && IsPoint(BT) && IsVector(RBT) && Is3D(RBT))
+    StaticAssert::invalid_vector3_to_xy_point_addition operator+=(const Cloud<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_vector3_to_xy_point_addition{};
+    }
+    template <BaseType RBT> requires(IsXY(BT) && IsPoint(BT) && IsVector(RBT) && Is3D(RBT))
+    StaticAssert::invalid_vector3_from_xy_point_subtraction operator-=(const Base<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_vector3_from_xy_point_subtraction{};
+    }
+    template <BaseType RBT> requires(IsXY(BT) && IsPoint(BT) && IsVector(RBT) && Is3D(RBT))
+    StaticAssert::invalid_vector3_from_xy_point_subtraction operator-=(const Cloud<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_vector3_from_xy_point_subtraction{};
+    }
+    template <BaseType RBT> requires(IsXY(BT) && IsVector(BT) && IsVector(RBT) && Is3D(RBT))
+    StaticAssert::invalid_vector_to_vector_addition operator+=(const Base<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_vector_to_vector_addition{};
+    }
+    template <BaseType RBT> requires(IsXY(BT) && IsVector(BT) && IsVector(RBT) && Is3D(RBT))
+    StaticAssert::invalid_vector_to_vector_addition operator+=(const Cloud<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_vector_to_vector_addition{};
+    }
+    template <BaseType RBT> requires(IsXY(BT) && IsVector(BT) && IsVector(RBT) && Is3D(RBT))
+    StaticAssert::invalid_vector_from_vector_subtraction operator-=(const Base<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_vector_from_vector_subtraction{};
+    }
+    template <BaseType RBT> requires(IsXY(BT) && IsVector(BT) && IsVector(RBT) && Is3D(RBT))
+    StaticAssert::invalid_vector_from_vector_subtraction operator-=(const Cloud<ThisSpace, UnderlyingData, RBT>&) noexcept {
+        return StaticAssert::invalid_vector_from_vector_subtraction{};
+    }
+
+    template <SameSpaceAs<ThisSpace> S, typename TransformManager>
+    StaticAssert::invalid_same_space_conversion ConvertTo(const TransformManager&) const noexcept {
+        return StaticAssert::invalid_same_space_conversion{};
+    }
+#endif
+
+  private:
+    template <typename S, typename U, BaseType B> friend class Cloud;
+    friend class CloudReference<ThisSpace, UnderlyingData, BT>;
+
+    [[nodiscard]] _value Load(const std::size_t i) const noexcept {
+        _value v;
+        auto out = v.begin();
+        for (const auto& column : columns) {
+            *out++ = column[i];
+        }
+        return v;
+    }
+
+    void Store(const std::size_t i, const _value& v) noexcept {
+        auto in = v.cbegin();
+        for (auto& column : columns) {
+            column[i] = *in++;
+        }
+    }
+
+    template <BaseType RBT> void CheckSameSize(const Cloud<ThisSpace, UnderlyingData, RBT>& rhs) const {
+        if (rhs.size() != size()) {
+            throw std::invalid_argument("Clouds must be the same size");
+        }
+    }
+
+    std::array<std::vector<Scalar>, Dimensions(BT)> columns;
+};
+
+template <typename ThisSpace, typename UnderlyingData> using PointCloud = Cloud<ThisSpace, UnderlyingData, BaseType::Point>;
+template <typename ThisSpace, typename UnderlyingData> using VectorCloud = Cloud<ThisSpace, UnderlyingData, BaseType::Vector>;
+template <typename ThisSpace, typename UnderlyingData> using XYPointCloud = Cloud<ThisSpace, UnderlyingData, BaseType::XYPoint>;
+template <typename ThisSpace, typename UnderlyingData> using XYVectorCloud = Cloud<ThisSpace, UnderlyingData, BaseType::XYVector>;
+
+} // namespace Space::implementation
@@ -0,0 +1,61 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// A space names the space which holds its coordinates at another precision
+/// with a PrecisionVariant alias.
+template <typename From, typename To>
+concept DeclaresPrecisionVariant =
+    requires { typename From::PrecisionVariant; } && std::same_as<typename From::PrecisionVariant, To>;
+
+/// Two spaces which describe the same coordinates at different precisions:
+/// one of them declares the other as its PrecisionVariant, and they have the
+/// same units and XY support. Spaces are never paired by their shape alone,
+/// so a point cannot be moved into an unrelated space which happens to match.
+template <typename From, typename To>
+concept PrecisionVariantOf = (DeclaresPrecisionVariant<From, To> || DeclaresPrecisionVariant<To, From>) &&
+                             std::same_as<typename From::Unit, typename To::Unit> && From::supportsXY == To::supportsXY &&
+                             !std::same_as<ScalarOf<From>, ScalarOf<To>>;
+
+template <typename S, BaseType BT> struct ElementOf;
+template <typename S> struct ElementOf<S, BaseType::Point> {
+    using type = typename S::Point;
+};
+template <typename S> struct ElementOf<S, BaseType::XYPoint> {
+    using type = typename S::XYPoint;
+};
+template <typename S> struct ElementOf<S, BaseType::Vector> {
+    using type = typename S::Vector;
+};
+template <typename S> struct ElementOf<S, BaseType::XYVector> {
+    using type = typename S::XYVector;
+};
+template <typename S> struct ElementOf<S, BaseType::NormalizedVector> {
+    using type = typename S::NormalizedVector;
+};
+template <typename S> struct ElementOf<S, BaseType::NormalizedXYVector> {
+    using type = typename S::NormalizedXYVector;
+};
+
+/// Converts a point or vector to the same type in a space with a different
+/// scalar type. Narrowing to a smaller type rounds each coordinate, and
+/// normalized vectors are renormalized at the new precision.
+template <typename To, typename From, typename UnderlyingData, BaseType BT> requires PrecisionVariantOf<From, To>
+[[nodiscard]] auto PrecisionCast(const Base<From, UnderlyingData, BT>& in) {
+    using _converted = typename ElementOf<To, BT>::type;
+    using _scalar = ScalarOf<To>;
+    if constexpr (Is3D(BT)) {
+        return _converted(static_cast<_scalar>(in.X()), static_cast<_scalar>(in.Y()), static_cast<_scalar>(in.Z()));
+    } else {
+        return _converted(static_cast<_scalar>(in.X()), static_cast<_scalar>(in.Y()));
+    }
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+template <typename To, typename From, typename UnderlyingData, BaseType BT> requires(!PrecisionVariantOf<From, To>)
+StaticAssert::invalid_precision_conversion PrecisionCast(const Base<From, UnderlyingData, BT>&) noexcept {
+    return StaticAssert::invalid_precision_conversion{};
+}
+#endif
+
+} // namespace Space::implementation
@@ -3,13 +3,45 @@
 /// This header provides the ThisSpace Point, Vector and NormalizedVector
 /// classes. Please see Readme.md for more details.
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
 #include <iostream>
+#include <limits>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <sstream>
 #include <format>
 #include <print>
 #include <locale>
+#include <span>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <version>
+
+#if defined(__cpp_lib_simd)
+#include <simd>
+#elif __has_include(<experimental/simd>)
+#include <experimental/simd>
+#endif
+
+#if defined(__AVX2__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
 
 namespace Space::implementation {
 
@@ -23,21 +55,45 @@ template <typename ThisSpace, typename UnderlyingData> class NormalizedXYVector;
 
 #include "detail/StaticAsserts.h"
 #include "detail/SpaceImpl.h"
-#include "detail/Base.h"
+#include "UnderlyingDataAccess.h"
 #include "detail/Helpers.h"
+#include "detail/Base.h"
+#include "detail/BatchTransform.h"
+#include "detail/SimdKernels.h"
+#include "detail/Threads.h"
+#include "detail/AffineMatrix.h"
 #include "NormalizedVector.h"
 #include "NormalizedXYVector.h"
 #include "Point.h"
 #include "Vector.h"
 #include "XYPoint.h"
 #include "XYVector.h"
+#include "PointCloud.h"
+#include "Span.h"
+#include "SpanMath.h"
+#include "Bounds.h"
+#include "KdTree.h"
+#include "SpatialHashGrid.h"
+#include "Bvh.h"
+#include "Octree.h"
+#include "Morton.h"
+#include "ConvertAll.h"
+#include "AffineTransform.h"
+#include "TransformGraph.h"
+#include "DispatchTable.h"
+#include "Precision.h"
+#include "Parse.h"
+#include "Binary.h"
 
 namespace Space {
 
 enum class XY { IsUsed = true, IsNotUsed = false };
 
-template <typename ThisSpace, typename UnderlyingData, XY xy, typename Units> struct SpaceBase {
+/// ScalarType is the type of each coordinate in UnderlyingData, so a space
+/// whose UnderlyingData holds three floats should use float.
+template <typename ThisSpace, typename UnderlyingData, XY xy, typename Units, typename ScalarType = double> struct SpaceBase {
     using Unit = Units;
+    using Scalar = ScalarType;
 
     static constexpr bool supportsXY = static_cast<bool>(xy);
     static constexpr bool doesNotSupportXY = !static_cast<bool>(xy);
@@ -48,5 +104,24 @@ template <typename ThisSpace, typename UnderlyingData, XY xy, typename Units> st
     using XYVector = implementation::XYVector<ThisSpace, UnderlyingData>;
     using NormalizedVector = implementation::NormalizedVector<ThisSpace, UnderlyingData>;
     using NormalizedXYVector = implementation::NormalizedXYVector<ThisSpace, UnderlyingData>;
+
+    using PointCloud = implementation::PointCloud<ThisSpace, UnderlyingData>;
+    using VectorCloud = implementation::VectorCloud<ThisSpace, UnderlyingData>;
+    using XYPointCloud = implementation::XYPointCloud<ThisSpace, UnderlyingData>;
+    using XYVectorCloud = implementation::XYVectorCloud<ThisSpace, UnderlyingData>;
+
+    using AABB = implementation::AABB<ThisSpace, UnderlyingData>;
+    using XYAABB = implementation::XYAABB<ThisSpace, UnderlyingData>;
+    using KdTree = implementation::KdTree<ThisSpace, UnderlyingData>;
+    using SpatialHashGrid = implementation::SpatialHashGrid<ThisSpace, UnderlyingData>;
+    using Ray = implementation::Ray<ThisSpace, UnderlyingData>;
+    using Bvh = implementation::Bvh<ThisSpace, UnderlyingData>;
+    using Octree = implementation::Octree<ThisSpace, UnderlyingData>;
+
+    using PointSpan = implementation::PointSpan<ThisSpace, UnderlyingData>;
+    using ConstPointSpan = implementation::ConstPointSpan<ThisSpace, UnderlyingData>;
+    using VectorSpan = implementation::VectorSpan<ThisSpace, UnderlyingData>;
+    using ConstVectorSpan = implementation::ConstVectorSpan<ThisSpace, UnderlyingData>;
+    using NormalizedVectorSpan = implementation::NormalizedVectorSpan<ThisSpace, UnderlyingData>;
 };
 } // namespace Space
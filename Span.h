@@ -0,0 +1,166 @@
+#pragma once
+
+namespace Space::implementation {
+
+template <typename S, typename U, BaseType B> S SpaceTypeOf(const Base<S, U, B>&);
+template <typename S, typename U, BaseType B> U UnderlyingTypeOf(const Base<S, U, B>&);
+template <typename S, typename U, BaseType B> std::integral_constant<BaseType, B> BaseTypeOf(const Base<S, U, B>&);
+
+/// A non-owning view of contiguous typed points or vectors. It can be made
+/// from existing typed storage, or laid over a buffer of UnderlyingData or raw
+/// scalars without copying, and hands the buffer back the same way.
+template <typename Element> class Span final {
+    using _value = std::remove_const_t<Element>;
+    using _underlying = decltype(UnderlyingTypeOf(std::declval<const _value&>()));
+
+    using _space = decltype(SpaceTypeOf(std::declval<const _value&>()));
+    static constexpr BaseType _baseType = decltype(BaseTypeOf(std::declval<const _value&>()))::value;
+
+    static constexpr bool isConst = std::is_const_v<Element>;
+    using _underlyingElement = std::conditional_t<isConst, const _underlying, _underlying>;
+    using _scalar = std::conditional_t<isConst, const typename _value::Scalar, typename _value::Scalar>;
+
+    static_assert(sizeof(_value) == sizeof(_underlying), "Typed elements must have the same layout as the underlying data.");
+    static constexpr bool isPacked = sizeof(_underlying) == 3 * sizeof(_scalar);
+    static constexpr bool isDouble = std::is_same_v<std::remove_const_t<_scalar>, double>;
+
+  public:
+    using element_type = Element;
+    using value_type = _value;
+    using size_type = std::size_t;
+    using reference = Element&;
+    using iterator = Element*;
+
+    Span() noexcept = default;
+    Span(std::span<Element> elements) noexcept : elements(elements) {}
+
+    template <typename Range> requires(std::is_constructible_v<std::span<Element>, Range &&>)
+    Span(Range&& range) noexcept : elements(std::forward<Range>(range)) {}
+
+    explicit Span(std::span<_underlyingElement> data) noexcept
+        : elements(reinterpret_cast<Element*>(data.data()), data.size()) {}
+
+    explicit Span(std::span<_scalar> scalars) requires(isPacked)
+        : elements(reinterpret_cast<Element*>(scalars.data()), scalars.size() / 3) {
+        if (scalars.size() % 3 != 0) {
+            throw std::invalid_argument(isDouble ? "The number of doubles must be a multiple of three"
+                                                 : "The number of scalars must be a multiple of three");
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return elements.size(); }
+    [[nodiscard]] bool empty() const noexcept { return elements.empty(); }
+
+    [[nodiscard]] Element& operator[](const std::size_t i) const noexcept { return elements[i]; }
+    [[nodiscard]] Element& front() const noexcept { return elements.front(); }
+    [[nodiscard]] Element& back() const noexcept { return elements.back(); }
+    [[nodiscard]] Element* data() const noexcept { return elements.data(); }
+
+    [[nodiscard]] Element* begin() const noexcept { return elements.data(); }
+    [[nodiscard]] Element* end() const noexcept { return elements.data() + elements.size(); }
+
+    [[nodiscard]] Span first(const std::size_t count) const noexcept { return Span(elements.first(count)); }
+    [[nodiscard]] Span last(const std::size_t count) const noexcept { return Span(elements.last(count)); }
+    [[nodiscard]] Span subspan(const std::size_t offset, const std::size_t count = std::dynamic_extent) const noexcept {
+        return Span(elements.subspan(offset, count));
+    }
+
+    [[nodiscard]] std::span<_underlyingElement> Underlying() const noexcept {
+        return {reinterpret_cast<_underlyingElement*>(elements.data()), elements.size()};
+    }
+
+    [[nodiscard]] std::span<_scalar> Scalars() const noexcept requires(isPacked)
+    {
+        return {reinterpret_cast<_scalar*>(elements.data()), elements.size() * 3};
+    }
+
+    [[nodiscard]] std::span<_scalar> Doubles() const noexcept requires(isPacked && isDouble)
+    {
+        return Scalars();
+    }
+
+    template <DifferentSpaceTo<_space> OtherSpace, typename TransformManager, typename OtherElement>
+    void ConvertTo(const TransformManager& transform_manager, const Span<OtherElement>& out) const {
+        using _converted = decltype(std::declval<const _value&>().template ConvertTo<OtherSpace>(transform_manager));
+        static_assert(std::is_same_v<OtherElement, _converted>, "The output span must hold the converted type.");
+        if (out.size() != size()) {
+            throw std::invalid_argument("Spans must be the same size");
+        }
+        Transform<_space, OtherSpace, _baseType>(
+            transform_manager, std::span<const _underlying>(Underlying()), out.Underlying()
+        );
+    }
+
+    template <DifferentSpaceTo<_space> OtherSpace, typename TransformManager>
+    [[nodiscard]] auto ConvertTo(const TransformManager& transform_manager) const {
+        using _converted = decltype(std::declval<const _value&>().template ConvertTo<OtherSpace>(transform_manager));
+        std::vector<_converted> converted(size());
+        ConvertTo<OtherSpace>(transform_manager, Span<_converted>(converted));
+        return converted;
+    }
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+    template <SameSpaceAs<_space> S, typename TransformManager>
+    StaticAssert::invalid_same_space_conversion ConvertTo(const TransformManager&) const noexcept {
+        return StaticAssert::invalid_same_space_conversion{};
+    }
+#endif
+
+  private:
+    std::span<Element> elements;
+};
+
+template <typename ThisSpace, typename UnderlyingData> using PointSpan = Span<Point<ThisSpace, UnderlyingData>>;
+template <typename ThisSpace, typename UnderlyingData> using ConstPointSpan = Span<const Point<ThisSpace, UnderlyingData>>;
+template <typename ThisSpace, typename UnderlyingData> using VectorSpan = Span<Vector<ThisSpace, UnderlyingData>>;
+template <typename ThisSpace, typename UnderlyingData> using ConstVectorSpan = Span<const Vector<ThisSpace, UnderlyingData>>;
+template <typename ThisSpace, typename UnderlyingData>
+using NormalizedVectorSpan = Span<NormalizedVector<ThisSpace, UnderlyingData>>;
+
+/// Normalizes every vector in a span without throwing. A vector which is too
+/// small to normalize is written as the default normalized vector, and its bit
+/// is set in failures, which holds one bit per vector. The input and output may
+/// be the same buffer. Returns the number of failures.
+template <typename ThisSpace, typename UnderlyingData>
+std::size_t NormalizeAll(
+    const ConstVectorSpan<ThisSpace, UnderlyingData>& in,
+    const NormalizedVectorSpan<ThisSpace, UnderlyingData>& out,
+    std::span<std::uint64_t> failures
+) {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Spans must be the same size");
+    }
+    constexpr std::size_t bits = 64;
+    const std::size_t words = (in.size() + bits - 1) / bits;
+    if (failures.size() < words) {
+        throw std::invalid_argument("There must be a failure bit for every vector");
+    }
+    std::fill_n(failures.begin(), words, 0);
+
+    const auto input = in.Underlying();
+    const auto output = out.Underlying();
+    using Scalar = ScalarOf<ThisSpace>;
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        const Scalar* v = CBegin<Scalar>(input[i]);
+        const Scalar x = v[0];
+        const Scalar y = v[1];
+        const Scalar z = v[2];
+        const Scalar mag = std::sqrt(x * x + y * y + z * z);
+        const bool tooSmall = mag < normalizationTolerance;
+        const Scalar scale = tooSmall ? Scalar{0} : Scalar{1} / mag;
+
+        Scalar* n = Begin<Scalar>(output[i]);
+        n[0] = tooSmall ? Scalar{1} : x * scale;
+        n[1] = y * scale;
+        n[2] = z * scale;
+        failures[i / bits] |= std::uint64_t{tooSmall} << (i % bits);
+        failed += tooSmall;
+    }
+    return failed;
+}
+
+} // namespace Space::implementation
+
+template <typename Element> inline constexpr bool std::ranges::enable_borrowed_range<Space::implementation::Span<Element>> = true;
+template <typename Element> inline constexpr bool std::ranges::enable_view<Space::implementation::Span<Element>> = true;
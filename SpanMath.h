@@ -0,0 +1,123 @@
+#pragma once
+
+namespace Space::implementation {
+
+template <typename Element> using ValueOfSpan = std::remove_const_t<Element>;
+
+template <typename Lhs, typename Rhs>
+using SumOf = decltype(std::declval<const ValueOfSpan<Lhs>&>() + std::declval<const ValueOfSpan<Rhs>&>());
+template <typename Lhs, typename Rhs>
+using DifferenceOf = decltype(std::declval<const ValueOfSpan<Lhs>&>() - std::declval<const ValueOfSpan<Rhs>&>());
+template <typename Element> using ScaledOf = decltype(std::declval<const ValueOfSpan<Element>&>() * 1.0);
+template <typename Lhs, typename Rhs>
+using DotOf = decltype(std::declval<const ValueOfSpan<Lhs>&>().Dot(std::declval<const ValueOfSpan<Rhs>&>()));
+template <typename Lhs, typename Rhs>
+using CrossOf = decltype(std::declval<const ValueOfSpan<Lhs>&>().Cross(std::declval<const ValueOfSpan<Rhs>&>()));
+
+template <typename Element> constexpr BaseType BaseTypeOfSpan = decltype(BaseTypeOf(std::declval<const ValueOfSpan<Element>&>()))::value;
+
+template <typename Element> using ScalarOfSpan = typename ValueOfSpan<Element>::Scalar;
+template <typename Element> using SpaceOfSpan = decltype(SpaceTypeOf(std::declval<const ValueOfSpan<Element>&>()));
+
+/// Points to x of the first element, which may not be at the start of the
+/// underlying data. An empty span has no elements to point into.
+template <typename Element>
+using AccessOfSpan = AccessOf<ScalarOfSpan<Element>, decltype(UnderlyingTypeOf(std::declval<const ValueOfSpan<Element>&>()))>;
+
+template <typename Element> [[nodiscard]] static auto SpanScalars(const Span<Element>& span) noexcept {
+    using _scalar = std::conditional_t<std::is_const_v<Element>, const ScalarOfSpan<Element>, ScalarOfSpan<Element>>;
+    return span.empty() ? static_cast<_scalar*>(nullptr) : AccessOfSpan<Element>::Data(span.Underlying().front());
+}
+template <typename Element> constexpr std::size_t strideOf = AccessOfSpan<Element>::stride;
+
+static void CheckSizes(const std::size_t a, const std::size_t b) {
+    if (a != b) {
+        throw std::invalid_argument("Spans must be the same size");
+    }
+}
+
+/// The span functions below apply the operation of the same name to every
+/// element, with the same rules as for single points and vectors: the output
+/// span must hold the type that the operation would return. The output may be
+/// the same span as an input.
+template <typename Lhs, typename Rhs, typename Out> requires(std::same_as<Out, SumOf<Lhs, Rhs>>)
+void Add(const Span<Lhs>& lhs, const Span<Rhs>& rhs, const Span<Out>& out) {
+    CheckSizes(lhs.size(), rhs.size());
+    CheckSizes(lhs.size(), out.size());
+    ComponentwiseKernel(
+        SpanScalars(lhs), SpanScalars(rhs), SpanScalars(out), out.size(), strideOf<Out>, [](auto a, auto b) { return a + b; }
+    );
+}
+
+template <typename Lhs, typename Rhs, typename Out> requires(std::same_as<Out, DifferenceOf<Lhs, Rhs>>)
+void Sub(const Span<Lhs>& lhs, const Span<Rhs>& rhs, const Span<Out>& out) {
+    CheckSizes(lhs.size(), rhs.size());
+    CheckSizes(lhs.size(), out.size());
+    ComponentwiseKernel(
+        SpanScalars(lhs), SpanScalars(rhs), SpanScalars(out), out.size(), strideOf<Out>, [](auto a, auto b) { return a - b; }
+    );
+}
+
+template <typename Element, typename Out> requires(std::same_as<Out, ScaledOf<Element>>)
+void Scale(const Span<Element>& in, const double d, const Span<Out>& out) {
+    CheckSizes(in.size(), out.size());
+    const auto s = static_cast<ScalarOfSpan<Out>>(d);
+    ComponentwiseKernel(SpanScalars(in), SpanScalars(out), out.size(), strideOf<Out>, [s](auto a) { return a * s; });
+}
+
+template <typename Lhs, typename Rhs> requires(std::same_as<ScalarOfSpan<Lhs>, DotOf<Lhs, Rhs>>)
+void Dot(const Span<Lhs>& lhs, const Span<Rhs>& rhs, std::span<ScalarOfSpan<Lhs>> out) {
+    CheckSizes(lhs.size(), rhs.size());
+    CheckSizes(lhs.size(), out.size());
+    DotKernel(SpanScalars(lhs), SpanScalars(rhs), out.data(), out.size(), strideOf<Lhs>);
+}
+
+/// Crossing two normalized vectors gives a normalized vector, which would
+/// need normalizing element by element, so only unnormalized results are supported.
+template <typename Lhs, typename Rhs, typename Out>
+requires(std::same_as<Out, CrossOf<Lhs, Rhs>> && IsNotNormalized(BaseTypeOfSpan<Out>))
+void Cross(const Span<Lhs>& lhs, const Span<Rhs>& rhs, const Span<Out>& out) {
+    CheckSizes(lhs.size(), rhs.size());
+    CheckSizes(lhs.size(), out.size());
+    CrossKernel(SpanScalars(lhs), SpanScalars(rhs), SpanScalars(out), out.size(), strideOf<Out>);
+}
+
+template <typename Element> requires requires(const ValueOfSpan<Element>& e) {
+    { e.Mag_double() } -> std::same_as<double>;
+}
+void Mag(const Span<Element>& in, std::span<ScalarOfSpan<Element>> out) {
+    CheckSizes(in.size(), out.size());
+    MagKernel(SpanScalars(in), out.data(), out.size(), strideOf<Element>);
+}
+
+template <typename First, typename... Rest>
+concept SpansShareSpace = (std::is_same_v<SpaceOfSpan<First>, SpaceOfSpan<Rest>> && ...);
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+template <typename Lhs, typename Rhs, typename Out> requires(!SpansShareSpace<Lhs, Rhs, Out>)
+StaticAssert::invalid_space Add(const Span<Lhs>&, const Span<Rhs>&, const Span<Out>&) noexcept {
+    return StaticAssert::invalid_space{};
+}
+
+template <typename Lhs, typename Rhs, typename Out> requires(!SpansShareSpace<Lhs, Rhs, Out>)
+StaticAssert::invalid_space Sub(const Span<Lhs>&, const Span<Rhs>&, const Span<Out>&) noexcept {
+    return StaticAssert::invalid_space{};
+}
+
+template <typename Element, typename Out> requires(!SpansShareSpace<Element, Out>)
+StaticAssert::invalid_space Scale(const Span<Element>&, const double, const Span<Out>&) noexcept {
+    return StaticAssert::invalid_space{};
+}
+
+template <typename Lhs, typename Rhs> requires(!SpansShareSpace<Lhs, Rhs>)
+StaticAssert::invalid_space Dot(const Span<Lhs>&, const Span<Rhs>&, std::span<ScalarOfSpan<Lhs>>) noexcept {
+    return StaticAssert::invalid_space{};
+}
+
+template <typename Lhs, typename Rhs, typename Out> requires(!SpansShareSpace<Lhs, Rhs, Out>)
+StaticAssert::invalid_space Cross(const Span<Lhs>&, const Span<Rhs>&, const Span<Out>&) noexcept {
+    return StaticAssert::invalid_space{};
+}
+#endif
+
+} // namespace Space::implementation
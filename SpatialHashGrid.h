@@ -0,0 +1,239 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// A uniform grid over the points of one space, for scenes where points are
+/// added, removed and moved too often to rebuild a KdTree. Each point is kept
+/// in a hashed cell, so inserting, removing and moving a point take constant
+/// time on average. The cell size and search radius are in the units of the
+/// space, so a grid cannot be given a length from another space by mistake.
+///
+/// Points are identified by the id returned from Insert, which stays the same
+/// until the point is removed, after which it may be given to a new point.
+template <typename ThisSpace, typename UnderlyingData> class SpatialHashGrid final {
+    using _point = Point<ThisSpace, UnderlyingData>;
+    using _unit = typename ThisSpace::Unit;
+
+  public:
+    using Scalar = ScalarOf<ThisSpace>;
+    using Neighbour = implementation::Neighbour<Scalar>;
+
+    explicit SpatialHashGrid(const _unit& cellSize) : cellWidth(static_cast<Scalar>(ValueOfUnit(cellSize))) {
+        if (!(cellWidth > 0)) {
+            throw std::invalid_argument("The cell size of a grid must be greater than zero");
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return entries.size() - freeIds.size(); }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    void clear() noexcept {
+        cells.clear();
+        entries.clear();
+        freeIds.clear();
+    }
+
+    /// Adds a point and returns its id. Throws if the point is too far from
+    /// the origin for its cell to be represented.
+    std::size_t Insert(const _point& p) {
+        const std::array<Scalar, 3> position{p.X(), p.Y(), p.Z()};
+        const Cell cell = CellOf(position);
+        std::size_t id;
+        if (freeIds.empty()) {
+            id = entries.size();
+            entries.emplace_back();
+        } else {
+            id = freeIds.back();
+            freeIds.pop_back();
+        }
+        entries[id] = {position, cell, 0, true};
+        Add(id);
+        return id;
+    }
+
+    void Remove(const std::size_t id) {
+        CheckId(id);
+        Take(id);
+        entries[id].used = false;
+        freeIds.push_back(id);
+    }
+
+    /// Moves a point to a new position, keeping its id.
+    void Move(const std::size_t id, const _point& p) {
+        CheckId(id);
+        const std::array<Scalar, 3> position{p.X(), p.Y(), p.Z()};
+        const Cell cell = CellOf(position);
+        Entry& entry = entries[id];
+        entry.position = position;
+        if (cell != entry.cell) {
+            Take(id);
+            entry.cell = cell;
+            Add(id);
+        }
+    }
+
+    [[nodiscard]] _point Position(const std::size_t id) const {
+        CheckId(id);
+        const auto& c = entries[id].position;
+        return _point(c[0], c[1], c[2]);
+    }
+
+    /// Every point no further than radius from the query, closest first, with
+    /// the id of each point as its index. The results replace the contents of
+    /// out, so that one vector can be reused between searches.
+    void WithinRadius(const _point& query, const _unit& radius, std::vector<Neighbour>& out) const {
+        out.clear();
+        const auto r = static_cast<Scalar>(ValueOfUnit(radius));
+        if (r < 0 || empty()) {
+            return;
+        }
+        const std::array<Scalar, 3> q{query.X(), query.Y(), query.Z()};
+        const Scalar radiusSquared = r * r;
+        const auto visit = [&](const std::vector<std::size_t>& ids) {
+            for (const std::size_t id : ids) {
+                const auto& c = entries[id].position;
+                const Scalar dx = c[0] - q[0];
+                const Scalar dy = c[1] - q[1];
+                const Scalar dz = c[2] - q[2];
+                const Scalar distanceSquared = dx * dx + dy * dy + dz * dz;
+                if (distanceSquared <= radiusSquared) {
+                    out.push_back({id, distanceSquared});
+                }
+            }
+        };
+
+        // Look up each cell that the sphere touches, unless there are more of
+        // those than there are occupied cells.
+        std::array<double, 3> lo;
+        std::array<double, 3> hi;
+        double touched = 1;
+        for (std::size_t d = 0; d < 3; ++d) {
+            lo[d] = std::floor((q[d] - r) / cellWidth);
+            hi[d] = std::floor((q[d] + r) / cellWidth);
+            touched *= std::abs(lo[d]) < cellLimit && std::abs(hi[d]) < cellLimit ? hi[d] - lo[d] + 1 : cellLimit;
+        }
+        if (touched <= static_cast<double>(cells.size())) {
+            for (auto x = static_cast<std::int64_t>(lo[0]); x <= static_cast<std::int64_t>(hi[0]); ++x) {
+                for (auto y = static_cast<std::int64_t>(lo[1]); y <= static_cast<std::int64_t>(hi[1]); ++y) {
+                    for (auto z = static_cast<std::int64_t>(lo[2]); z <= static_cast<std::int64_t>(hi[2]); ++z) {
+                        if (const auto cell = cells.find({x, y, z}); cell != cells.end()) {
+                            visit(cell->second);
+                        }
+                    }
+                }
+            }
+        } else {
+            for (const auto& [cell, ids] : cells) {
+                visit(ids);
+            }
+        }
+
+        std::sort(out.begin(), out.end(), Closer<Scalar>);
+        for (auto& neighbour : out) {
+            neighbour.distance = std::sqrt(neighbour.distance);
+        }
+    }
+
+    [[nodiscard]] std::vector<Neighbour> WithinRadius(const _point& query, const _unit& radius) const {
+        std::vector<Neighbour> out;
+        WithinRadius(query, radius, out);
+        return out;
+    }
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space Insert(const Base<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType>
+    StaticAssert::invalid_space Move(std::size_t, const Base<OtherSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_space{};
+    }
+    template <DifferentSpaceTo<ThisSpace> OtherSpace, BaseType OtherBaseType, typename... Args>
+    StaticAssert::invalid_space WithinRadius(const Base<OtherSpace, UnderlyingData, OtherBaseType>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_space{};
+    }
+
+    template <BaseType OtherBaseType> requires(OtherBaseType != BaseType::Point)
+    StaticAssert::invalid_spatial_query Insert(const Base<ThisSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_spatial_query{};
+    }
+    template <BaseType OtherBaseType> requires(OtherBaseType != BaseType::Point)
+    StaticAssert::invalid_spatial_query Move(std::size_t, const Base<ThisSpace, UnderlyingData, OtherBaseType>&) noexcept {
+        return StaticAssert::invalid_spatial_query{};
+    }
+    template <BaseType OtherBaseType, typename... Args> requires(OtherBaseType != BaseType::Point)
+    StaticAssert::invalid_spatial_query
+    WithinRadius(const Base<ThisSpace, UnderlyingData, OtherBaseType>&, Args&&...) const noexcept {
+        return StaticAssert::invalid_spatial_query{};
+    }
+#endif
+
+  private:
+    using Cell = std::array<std::int64_t, 3>;
+
+    /// Cells are only numbered up to 2^62, which also rules out points that are not finite.
+    static constexpr double cellLimit = 4611686018427387904.0;
+
+    struct CellHash final {
+        [[nodiscard]] std::size_t operator()(const Cell& cell) const noexcept {
+            // Multiplying by large odd constants spreads neighbouring cells across the table.
+            const auto x = static_cast<std::uint64_t>(cell[0]) * 0x9E3779B185EBCA87ULL;
+            const auto y = static_cast<std::uint64_t>(cell[1]) * 0xC2B2AE3D27D4EB4FULL;
+            const auto z = static_cast<std::uint64_t>(cell[2]) * 0x165667B19E3779F9ULL;
+            return static_cast<std::size_t>(x ^ y ^ z);
+        }
+    };
+
+    /// slot is the position of the entry's id in the list of its cell.
+    struct Entry final {
+        std::array<Scalar, 3> position{};
+        Cell cell{};
+        std::size_t slot = 0;
+        bool used = false;
+    };
+
+    [[nodiscard]] Cell CellOf(const std::array<Scalar, 3>& position) const {
+        Cell cell;
+        for (std::size_t d = 0; d < 3; ++d) {
+            const double index = std::floor(static_cast<double>(position[d]) / cellWidth);
+            if (!(std::abs(index) < cellLimit)) {
+                throw std::invalid_argument("The point is too far from the origin for the cell size of the grid");
+            }
+            cell[d] = static_cast<std::int64_t>(index);
+        }
+        return cell;
+    }
+
+    void CheckId(const std::size_t id) const {
+        if (id >= entries.size() || !entries[id].used) {
+            throw std::invalid_argument("There is no point with this id in the grid");
+        }
+    }
+
+    void Add(const std::size_t id) {
+        auto& ids = cells[entries[id].cell];
+        entries[id].slot = ids.size();
+        ids.push_back(id);
+    }
+
+    /// Takes the id out of its cell by moving the last id of the cell into its
+    /// slot, and drops the cell once it is empty.
+    void Take(const std::size_t id) {
+        const auto cell = cells.find(entries[id].cell);
+        auto& ids = cell->second;
+        const std::size_t last = ids.back();
+        ids[entries[id].slot] = last;
+        entries[last].slot = entries[id].slot;
+        ids.pop_back();
+        if (ids.empty()) {
+            cells.erase(cell);
+        }
+    }
+
+    Scalar cellWidth;
+    std::unordered_map<Cell, std::vector<std::size_t>, CellHash> cells;
+    std::vector<Entry> entries;
+    std::vector<std::size_t> freeIds;
+};
+} // namespace Space::implementation
@@ -0,0 +1,159 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+// Rotates by 90 degrees about z and translates by (10, 20, 30).
+AffineTransform<View, Image> RotateAndTranslate() {
+    return AffineTransform<View, Image>({{{0, -1, 0, 10}, {1, 0, 0, 20}, {0, 0, 1, 30}}});
+}
+
+// Scales by 2 and translates by (1, 1, 1).
+AffineTransform<Image, Data> ScaleAndTranslate() {
+    return AffineTransform<Image, Data>({{{2, 0, 0, 1}, {0, 2, 0, 1}, {0, 0, 2, 1}}});
+}
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("AffineTransforms are the identity by default") {
+    const AffineTransform<View, Image> t;
+    CHECK(t.Apply(View::Point(1, 2, 3)) == Image::Point(1, 2, 3));
+}
+
+TEST_CASE("AffineTransforms can be created from rows") {
+    const auto t = RotateAndTranslate();
+    CHECK(t(0, 1) == -1);
+    CHECK(t(1, 0) == 1);
+    CHECK(t(2, 3) == 30);
+}
+
+TEST_CASE("AffineTransforms apply the translation to points") {
+    const auto t = RotateAndTranslate();
+    const Image::Point p = t.Apply(View::Point(1, 2, 3));
+    CHECK(p == Image::Point(8, 21, 33));
+}
+
+TEST_CASE("AffineTransforms apply the translation to XYPoints") {
+    const auto t = RotateAndTranslate();
+    const Image::Point p = t.Apply(View::XYPoint(1, 2));
+    CHECK(p == Image::Point(8, 21, 30));
+}
+
+TEST_CASE("AffineTransforms do not apply the translation to vectors") {
+    const auto t = RotateAndTranslate();
+    const Image::Vector v = t.Apply(View::Vector(1, 2, 3));
+    CHECK(v == Image::Vector(-2, 1, 3));
+}
+
+TEST_CASE("AffineTransforms turn normalized vectors into vectors") {
+    const auto t = ScaleAndTranslate();
+    const Data::Vector v = t.Apply(Image::NormalizedVector(1, 0, 0));
+    CHECK(v == Data::Vector(2, 0, 0));
+}
+
+TEST_CASE("AffineTransforms can be composed") {
+    const AffineTransform<View, Data> t = RotateAndTranslate() * ScaleAndTranslate();
+    const View::Point p(1, 2, 3);
+    CHECK(t.Apply(p) == ScaleAndTranslate().Apply(RotateAndTranslate().Apply(p)));
+    CHECK(t.Apply(p) == Data::Point(17, 43, 67));
+}
+
+TEST_CASE("AffineTransforms can be inverted") {
+    const AffineTransform<Image, View> inverse = RotateAndTranslate().Inverse();
+    CHECK(inverse.Apply(Image::Point(8, 21, 33)) == View::Point(1, 2, 3));
+    CHECK(inverse.Apply(Image::Vector(-2, 1, 3)) == View::Vector(1, 2, 3));
+}
+
+TEST_CASE("AffineTransforms throw if they cannot be inverted") {
+    const AffineTransform<View, Image> t({{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 0, 0}}});
+    CHECK_THROWS_WITH(t.Inverse(), "The transform cannot be inverted");
+}
+
+TEST_CASE("AffineTransforms can be used as transform managers") {
+    const auto t = RotateAndTranslate();
+    CHECK(View::Point(1, 2, 3).ConvertTo<Image>(t) == Image::Point(8, 21, 33));
+    CHECK(View::Vector(1, 2, 3).ConvertTo<Image>(t) == Image::Vector(-2, 1, 3));
+}
+
+TEST_CASE("AffineTransforms provide batch conversion") {
+    using namespace Space::implementation;
+    CHECK(BatchPointTransformer<AffineTransform<View, Image>, View, Image, TestVector>);
+    CHECK(BatchVectorTransformer<AffineTransform<View, Image>, View, Image, TestVector>);
+    CHECK(!BatchPointTransformer<AffineTransform<View, Image>, View, Data, TestVector>);
+}
+
+TEST_CASE("AffineTransforms can be applied to spans of points") {
+    const auto t = RotateAndTranslate();
+    std::vector<View::Point> points;
+    for (int i = 0; i < 7; ++i) {
+        points.emplace_back(i, 2 * i, 3 * i);
+    }
+    std::vector<Image::Point> converted(points.size());
+
+    t.Apply(View::ConstPointSpan(points), Image::PointSpan(converted));
+
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        CHECK(converted[i] == t.Apply(points[i]));
+    }
+}
+
+TEST_CASE("AffineTransforms can be applied to spans of vectors") {
+    const auto t = RotateAndTranslate();
+    std::vector<View::Vector> vectors;
+    for (int i = 0; i < 7; ++i) {
+        vectors.emplace_back(i, 2 * i, 3 * i);
+    }
+    std::vector<Image::Vector> converted(vectors.size());
+
+    t.Apply(View::ConstVectorSpan(vectors), Image::VectorSpan(converted));
+
+    for (std::size_t i = 0; i < vectors.size(); ++i) {
+        CHECK(converted[i] == t.Apply(vectors[i]));
+    }
+}
+
+TEST_CASE("AffineTransforms leave the rest of the underlying data untouched") {
+    struct Padded {
+        double x = 0;
+        double y = 0;
+        double z = 0;
+        double tag = 0;
+    };
+    struct PaddedView final : SpaceBase<PaddedView, Padded, XY::IsNotUsed, double> {};
+    struct PaddedData final : SpaceBase<PaddedData, Padded, XY::IsNotUsed, double> {};
+
+    std::vector<Padded> in(3, Padded{1, 2, 3, 42});
+    std::vector<Padded> out(3, Padded{0, 0, 0, 7});
+    const AffineTransform<PaddedView, PaddedData> t({{{1, 0, 0, 1}, {0, 1, 0, 1}, {0, 0, 1, 1}}});
+
+    t.Apply(PaddedView::ConstPointSpan(in), PaddedData::PointSpan(out));
+
+    CHECK(out[2].x == 2);
+    CHECK(out[2].z == 4);
+    CHECK(out[2].tag == 7);
+}
+
+TEST_CASE("AffineTransforms throw if spans have different sizes") {
+    const auto t = RotateAndTranslate();
+    const std::vector<View::Point> points(2);
+    std::vector<Image::Point> converted(1);
+    CHECK_THROWS_WITH(t.Apply(View::ConstPointSpan(points), Image::PointSpan(converted)), "Spans must be the same size");
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("AffineTransforms cannot be composed unless the spaces meet") {
+    using converted_type = decltype(RotateAndTranslate() * RotateAndTranslate());
+    using required_type = StaticAssert::invalid_transform_composition;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type, required_type>));
+}
+
+TEST_CASE("AffineTransforms cannot be applied to points from other spaces") {
+    using converted_type = decltype(RotateAndTranslate().Apply(Image::Point()));
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type, required_type>));
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,125 @@
+#include "ExampleTransformManager.h"
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+class BatchTransformManager final {
+  public:
+    template <typename From, typename To> [[nodiscard]] TestVector TransformPoint(TestVector v) const noexcept {
+        ++pointCalls;
+        v.m_values[0] += 1;
+        return v;
+    }
+
+    template <typename From, typename To> [[nodiscard]] TestVector TransformVector(TestVector v) const noexcept {
+        ++vectorCalls;
+        v.m_values[1] += 1;
+        return v;
+    }
+
+    template <typename From, typename To>
+    void TransformPoints(std::span<const TestVector> in, std::span<TestVector> out) const noexcept {
+        ++pointBatches;
+        std::ranges::transform(in, out.begin(), [this](TestVector v) { return TransformPoint<From, To>(v); });
+    }
+
+    template <typename From, typename To>
+    void TransformVectors(std::span<const TestVector> in, std::span<TestVector> out) const noexcept {
+        ++vectorBatches;
+        std::ranges::transform(in, out.begin(), [this](TestVector v) { return TransformVector<From, To>(v); });
+    }
+
+    mutable int pointCalls = 0;
+    mutable int vectorCalls = 0;
+    mutable int pointBatches = 0;
+    mutable int vectorBatches = 0;
+};
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Batch transform managers are detected") {
+    using namespace Space::implementation;
+    CHECK(BatchPointTransformer<BatchTransformManager, View, Data, TestVector>);
+    CHECK(BatchVectorTransformer<BatchTransformManager, View, Data, TestVector>);
+    CHECK(!BatchPointTransformer<TransformManager, View, Data, TestVector>);
+    CHECK(!BatchVectorTransformer<TransformManager, View, Data, TestVector>);
+}
+
+TEST_CASE("Point spans are converted using a single batch call") {
+    const BatchTransformManager tm;
+    const std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+
+    const auto converted = View::ConstPointSpan(points).ConvertTo<Data>(tm);
+
+    CHECK(tm.pointBatches == 1);
+    CHECK(tm.pointCalls == 3);
+    CHECK(converted == std::vector<Data::Point>{{2, 2, 3}, {5, 5, 6}, {8, 8, 9}});
+}
+
+TEST_CASE("Vector spans are converted using a single batch call") {
+    const BatchTransformManager tm;
+    const std::vector<View::Vector> vectors{{1, 2, 3}, {4, 5, 6}};
+
+    const auto converted = View::ConstVectorSpan(vectors).ConvertTo<Data>(tm);
+
+    CHECK(tm.vectorBatches == 1);
+    CHECK(converted == std::vector<Data::Vector>{{1, 3, 3}, {4, 6, 6}});
+}
+
+TEST_CASE("Spans can be converted into existing storage") {
+    const BatchTransformManager tm;
+    const std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}};
+    std::vector<TestVector> impls(2);
+
+    View::ConstPointSpan(points).ConvertTo<Data>(tm, Data::PointSpan(impls));
+
+    CHECK(impls[0].m_values == std::array<double, 3>{2, 2, 3});
+    CHECK(impls[1].m_values == std::array<double, 3>{5, 5, 6});
+}
+
+TEST_CASE("Spans throw if converted into storage of a different size") {
+    const BatchTransformManager tm;
+    const std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}};
+    std::vector<Data::Point> converted(1);
+    CHECK_THROWS_WITH(
+        View::ConstPointSpan(points).ConvertTo<Data>(tm, Data::PointSpan(converted)), "Spans must be the same size"
+    );
+}
+
+TEST_CASE("Spans fall back to per-element conversion") {
+    TransformManager tm;
+    tm.SetDataPointValues(1, 2, 3);
+    const std::vector<View::Point> points{{4, 5, 6}, {7, 8, 9}};
+
+    const auto converted = View::ConstPointSpan(points).ConvertTo<Data>(tm);
+
+    CHECK(converted == std::vector<Data::Point>{{1, 2, 3}, {1, 2, 3}});
+}
+
+TEST_CASE("Clouds are converted in blocks using batch calls") {
+    const BatchTransformManager tm;
+    View::PointCloud cloud(300);
+    cloud[299] = View::Point(1, 2, 3);
+
+    const auto converted = cloud.ConvertTo<Data>(tm);
+
+    CHECK(tm.pointBatches == 2);
+    CHECK(converted.size() == 300);
+    CHECK(converted[0] == Data::Point(1, 0, 0));
+    CHECK(converted[299] == Data::Point(2, 2, 3));
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("Spans cannot be converted to the same space") {
+    const BatchTransformManager tm;
+    const std::vector<View::Point> points;
+    using converted_type = decltype(View::ConstPointSpan(points).ConvertTo<View>(tm));
+    using required_type = StaticAssert::invalid_same_space_conversion;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type, required_type>));
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
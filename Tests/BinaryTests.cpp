@@ -0,0 +1,116 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Points can be written and read back in binary") {
+    const std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+    std::stringstream stream;
+    WriteBinary(stream, points);
+    CHECK(stream.str().size() == sizeof(BinaryHeader) + 9 * sizeof(double));
+
+    std::vector<View::Point> read{View::Point(0, 0, 0)};
+    CHECK(ReadBinary(stream, read) == 3);
+    CHECK(read.size() == 4);
+    CHECK(read[1] == View::Point(1, 2, 3));
+    CHECK(read[3] == View::Point(7, 8, 9));
+}
+
+TEST_CASE("The binary header records the space, type, count and scalar size") {
+    std::stringstream stream;
+    WriteBinary(stream, std::vector<Image::NormalizedVector>(5));
+
+    BinaryHeader header;
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    CHECK(std::string_view(header.space.data()) == "Image");
+    CHECK(header.baseType == static_cast<std::uint8_t>(implementation::BaseType::NormalizedVector));
+    CHECK(header.count == 5);
+    CHECK(header.scalarSize == sizeof(double));
+}
+
+TEST_CASE("XY types only store x and y") {
+    const std::vector<View::XYVector> vectors(300, View::XYVector(1, 2));
+    std::stringstream stream;
+    WriteBinary(stream, vectors);
+    CHECK(stream.str().size() == sizeof(BinaryHeader) + 600 * sizeof(double));
+
+    std::vector<View::XYVector> read;
+    CHECK(ReadBinary(stream, read) == 300);
+    CHECK(read[299] == View::XYVector(1, 2));
+}
+
+TEST_CASE("Binary data can only be read into the same space and type") {
+    std::stringstream stream;
+    WriteBinary(stream, std::vector<View::Point>(2));
+    const std::string bytes = stream.str();
+
+    std::stringstream otherSpace(bytes);
+    std::vector<Image::Point> images;
+    CHECK_THROWS_WITH(ReadBinary(otherSpace, images), "The data belongs to a different space");
+    CHECK(images.empty());
+
+    std::stringstream otherType(bytes);
+    std::vector<View::Vector> vectors;
+    CHECK_THROWS_WITH(ReadBinary(otherType, vectors), "The data holds a different type of point or vector");
+}
+
+TEST_CASE("Truncated binary data is rejected") {
+    std::stringstream stream;
+    WriteBinary(stream, std::vector<View::Point>(2));
+    const std::string bytes = stream.str();
+
+    std::stringstream noHeader(bytes.substr(0, 10));
+    std::vector<View::Point> points;
+    CHECK_THROWS_WITH(ReadBinary(noHeader, points), "The data ends before the binary header");
+
+    std::stringstream noCoordinates(bytes.substr(0, bytes.size() - 1));
+    CHECK_THROWS_WITH(ReadBinary(noCoordinates, points), "The data ends before all of its elements");
+    CHECK(points.empty());
+
+    std::stringstream notBinary(std::string(100, 'x'));
+    CHECK_THROWS_WITH(ReadBinary(notBinary, points), "The data is not in the binary point format");
+}
+
+TEST_CASE("Binary data with a corrupt count is rejected") {
+    std::stringstream stream;
+    WriteBinary(stream, std::vector<View::Point>(2));
+    std::string bytes = stream.str();
+
+    BinaryHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.count = std::uint64_t{1} << 40;
+    std::memcpy(bytes.data(), &header, sizeof(header));
+
+    std::vector<View::Point> points{View::Point(1, 2, 3)};
+    std::stringstream huge(bytes);
+    CHECK_THROWS_WITH(ReadBinary(huge, points), "The data ends before all of its elements");
+    CHECK(points == std::vector<View::Point>{View::Point(1, 2, 3)});
+
+    header.count = std::numeric_limits<std::uint64_t>::max();
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    std::stringstream wrapping(bytes);
+    CHECK_THROWS_WITH(ReadBinary(wrapping, points), "The data holds more elements than the container can");
+    CHECK(points.size() == 1);
+}
+
+TEST_CASE("Normalized vectors are renormalized when read") {
+    const std::vector<View::Vector> vectors{{3, 0, 0}, {0, 0, 2}};
+    std::stringstream stream;
+    WriteBinary(stream, vectors);
+    std::string bytes = stream.str();
+
+    // Relabel the vectors as normalized vectors, which they are not.
+    BinaryHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.baseType = static_cast<std::uint8_t>(implementation::BaseType::NormalizedVector);
+    std::memcpy(bytes.data(), &header, sizeof(header));
+
+    std::vector<View::NormalizedVector> read;
+    std::stringstream normalized(bytes);
+    CHECK(ReadBinary(normalized, read) == 2);
+    CHECK(read[0] == View::NormalizedVector(1, 0, 0));
+    CHECK(read[1] == View::NormalizedVector(0, 0, 1));
+    CHECK(read[1].Z() == 1);
+}
@@ -0,0 +1,121 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Bounding boxes are made from two corners in any order") {
+    const View::AABB box(View::Point(4, 0, 6), View::Point(1, 5, 3));
+    CHECK(box.Min() == View::Point(1, 0, 3));
+    CHECK(box.Max() == View::Point(4, 5, 6));
+    CHECK(box.Size() == View::Vector(3, 5, 3));
+    CHECK(box.Center() == View::Point(2.5, 2.5, 4.5));
+    CHECK(!box.IsEmpty());
+}
+
+TEST_CASE("A default bounding box is empty") {
+    View::AABB box;
+    CHECK(box.IsEmpty());
+    CHECK(!box.Contains(View::Point(0, 0, 0)));
+    CHECK(box == View::AABB());
+
+    box.Expand(View::Point(1, 2, 3));
+    CHECK(!box.IsEmpty());
+    CHECK(box.Contains(View::Point(1, 2, 3)));
+    CHECK(box.Size() == View::Vector(0, 0, 0));
+}
+
+TEST_CASE("Bounding boxes test containment and overlap") {
+    const View::AABB box(View::Point(0, 0, 0), View::Point(2, 2, 2));
+    CHECK(box.Contains(View::Point(1, 1, 1)));
+    CHECK(box.Contains(View::Point(2, 0, 2)));
+    CHECK(!box.Contains(View::Point(1, 3, 1)));
+
+    CHECK(box.Contains(View::AABB(View::Point(1, 1, 1), View::Point(2, 2, 2))));
+    CHECK(!box.Contains(View::AABB(View::Point(1, 1, 1), View::Point(3, 2, 2))));
+    CHECK(box.Overlaps(View::AABB(View::Point(1, 1, 1), View::Point(3, 3, 3))));
+    CHECK(box.Overlaps(View::AABB(View::Point(2, 2, 2), View::Point(3, 3, 3))));
+    CHECK(!box.Overlaps(View::AABB(View::Point(0, 0, 3), View::Point(1, 1, 4))));
+    CHECK(!box.Overlaps(View::AABB()));
+}
+
+TEST_CASE("Bounding boxes can be expanded by other boxes") {
+    View::AABB box(View::Point(0, 0, 0), View::Point(1, 1, 1));
+    box.Expand(View::AABB(View::Point(-1, 0, 0), View::Point(0, 3, 0))).Expand(View::AABB());
+    CHECK(box == View::AABB(View::Point(-1, 0, 0), View::Point(1, 3, 1)));
+}
+
+TEST_CASE("XY bounding boxes hold XY points") {
+    const View::XYAABB box(View::XYPoint(3, 0), View::XYPoint(1, 2));
+    CHECK(box.Min() == View::XYPoint(1, 0));
+    CHECK(box.Size() == View::XYVector(2, 2));
+    CHECK(box.Contains(View::XYPoint(2, 1)));
+    CHECK(!box.Contains(View::XYPoint(2, 3)));
+}
+
+TEST_CASE("Bounding boxes can be used in constant expressions") {
+    constexpr View::AABB box(View::Point(0, 0, 0), View::Point(2, 2, 2));
+    static_assert(box.Contains(View::Point(1, 1, 1)));
+    static_assert(box.Center() == View::Point(1, 1, 1));
+    CHECK(box.Contains(View::Point(1, 1, 1)));
+}
+
+TEST_CASE("The bounds of a span of points can be found") {
+    std::vector<View::Point> points;
+    for (int i = 0; i < 1001; ++i) {
+        points.emplace_back(i % 7, -i, i * 0.5);
+    }
+    CHECK(Bounds(View::ConstPointSpan(points)) == View::AABB(View::Point(0, -1000, 0), View::Point(6, 0, 500)));
+    CHECK(Bounds(View::ConstPointSpan()).IsEmpty());
+
+    const std::vector<View::XYPoint> xy{{1, 5}, {-2, 3}};
+    CHECK(Bounds(implementation::Span<const View::XYPoint>(xy)) == View::XYAABB(View::XYPoint(-2, 3), View::XYPoint(1, 5)));
+}
+
+TEST_CASE("The bounds of large spans are found in parallel") {
+    std::vector<View::Point> points(1 << 19, View::Point(1, 1, 1));
+    points[12345] = View::Point(-5, 1, 1);
+    points[(1 << 19) - 1] = View::Point(1, 9, 1);
+    points[(1 << 18) + 7] = View::Point(1, 1, -3);
+    CHECK(Bounds(View::ConstPointSpan(points)) == View::AABB(View::Point(-5, 1, -3), View::Point(1, 9, 1)));
+}
+
+TEST_CASE("The bounds of a cloud can be found") {
+    const View::PointCloud cloud{{1, 2, 3}, {-1, 5, 0}, {4, -2, 1}};
+    CHECK(Bounds(cloud) == View::AABB(View::Point(-1, -2, 0), View::Point(4, 5, 3)));
+
+    const View::XYPointCloud xy{{1, 2}, {-1, 5}};
+    CHECK(Bounds(xy) == View::XYAABB(View::XYPoint(-1, 2), View::XYPoint(1, 5)));
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("Bounding boxes from different spaces cannot interact") {
+    View::AABB box;
+    using contains_type = decltype(box.Contains(Image::Point()));
+    using overlaps_type = decltype(box.Overlaps(Image::AABB()));
+    using expand_type = decltype(box.Expand(Image::AABB()));
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<contains_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<overlaps_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<expand_type, required_type>));
+}
+
+TEST_CASE("Bounding boxes only hold points of their own dimensions") {
+    View::AABB box;
+    using xy_type = decltype(box.Contains(View::XYPoint()));
+    using vector_type = decltype(box.Expand(View::Vector()));
+    using box_type = decltype(box.Overlaps(View::XYAABB()));
+    using required_type = StaticAssert::invalid_bounds_dimensions;
+    CHECK(static_cast<bool>(std::is_same_v<xy_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<vector_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<box_type, required_type>));
+}
+
+TEST_CASE("Only the bounds of points can be found") {
+    const std::vector<View::Vector> vectors(3);
+    using converted_type = decltype(Bounds(View::ConstVectorSpan(vectors)));
+    using required_type = StaticAssert::invalid_vector_bounds;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type, required_type>));
+}
+#endif
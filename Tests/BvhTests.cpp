@@ -0,0 +1,176 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+#include <random>
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+namespace {
+
+/// A row of unit cubes along X, starting at 0, 2, 4 and so on.
+std::vector<View::AABB> RowOfCubes(const int count) {
+    std::vector<View::AABB> boxes;
+    for (int i = 0; i < count; ++i) {
+        boxes.emplace_back(View::Point(2 * i, 0, 0), View::Point(2 * i + 1, 1, 1));
+    }
+    return boxes;
+}
+
+std::vector<View::AABB> RandomBoxes(const std::size_t count, const unsigned seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> position(-100, 100);
+    std::uniform_real_distribution<double> size(0.1, 5);
+    std::vector<View::AABB> boxes;
+    for (std::size_t i = 0; i < count; ++i) {
+        const View::Point corner(position(generator), position(generator), position(generator));
+        boxes.emplace_back(corner, corner + View::Vector(size(generator), size(generator), size(generator)));
+    }
+    return boxes;
+}
+
+/// The distance along the ray at which it enters the box, found without a hierarchy.
+std::optional<double> EntryOf(const View::AABB& box, const View::Ray& ray) {
+    double near = 0;
+    double far = std::numeric_limits<double>::infinity();
+    const std::array lo{box.Min().X(), box.Min().Y(), box.Min().Z()};
+    const std::array hi{box.Max().X(), box.Max().Y(), box.Max().Z()};
+    const std::array origin{ray.Origin().X(), ray.Origin().Y(), ray.Origin().Z()};
+    const std::array direction{ray.Direction().X(), ray.Direction().Y(), ray.Direction().Z()};
+    for (std::size_t d = 0; d < 3; ++d) {
+        const double t0 = (lo[d] - origin[d]) / direction[d];
+        const double t1 = (hi[d] - origin[d]) / direction[d];
+        near = std::max(near, std::min(t0, t1));
+        far = std::min(far, std::max(t0, t1));
+    }
+    return near <= far ? std::optional(near) : std::nullopt;
+}
+} // namespace
+
+TEST_CASE("A ray has an origin and a normalized direction") {
+    const View::Ray ray(View::Point(1, 2, 3), View::NormalizedVector(0, 0, 2));
+    CHECK(ray.Direction() == View::NormalizedVector(0, 0, 1));
+    CHECK(ray.At(4) == View::Point(1, 2, 7));
+}
+
+TEST_CASE("A Bvh finds the boxes that a ray passes through, nearest first") {
+    const auto boxes = RowOfCubes(50);
+    const View::Bvh bvh{std::span<const View::AABB>(boxes)};
+    CHECK(bvh.size() == 50);
+    CHECK(bvh.Bounds() == View::AABB(View::Point(0, 0, 0), View::Point(99, 1, 1)));
+
+    const View::Ray along(View::Point(-1, 0.5, 0.5), View::NormalizedVector(1, 0, 0));
+    const auto hits = bvh.Intersecting(along, 10);
+    REQUIRE(hits.size() == 5);
+    for (std::size_t i = 0; i < hits.size(); ++i) {
+        CHECK(hits[i].index == i);
+        CHECK(hits[i].distance == Approx(2.0 * i + 1));
+    }
+
+    const View::Ray across(View::Point(4.5, -1, 0.5), View::NormalizedVector(0, 1, 0));
+    const auto crossing = bvh.Intersecting(across);
+    REQUIRE(crossing.size() == 1);
+    CHECK(crossing[0].index == 2);
+
+    const View::Ray between(View::Point(3.5, -1, 0.5), View::NormalizedVector(0, 1, 0));
+    CHECK(bvh.Intersecting(between).empty());
+}
+
+TEST_CASE("A Bvh finds the closest object that a ray hits") {
+    const auto boxes = RowOfCubes(50);
+    const View::Bvh bvh{std::span<const View::AABB>(boxes)};
+    const View::Ray ray(View::Point(-1, 0.5, 0.5), View::NormalizedVector(1, 0, 0));
+
+    // Objects in odd boxes are missed, so the first hit is in the box at 4.
+    std::vector<std::size_t> tested;
+    const auto hit = bvh.Closest(ray, [&](const std::size_t i) -> std::optional<double> {
+        tested.push_back(i);
+        return i % 2 == 1 || i == 0 ? std::nullopt : std::optional(2.0 * i + 1.5);
+    });
+    REQUIRE(hit);
+    CHECK(hit->index == 2);
+    CHECK(hit->distance == 5.5);
+    // Boxes behind the hit are not tested.
+    CHECK(std::ranges::all_of(tested, [](const std::size_t i) { return i <= 3; }));
+
+    CHECK(!bvh.Closest(ray, [](std::size_t) { return std::optional(100.0); }, 50));
+}
+
+TEST_CASE("A Bvh finds the boxes that overlap a box") {
+    const auto boxes = RowOfCubes(50);
+    const View::Bvh bvh{std::span<const View::AABB>(boxes)};
+    CHECK(bvh.Overlapping(View::AABB(View::Point(3.5, 0, 0), View::Point(8.5, 2, 2))) == std::vector<std::size_t>{2, 3, 4});
+    CHECK(bvh.Overlapping(View::AABB(View::Point(0, 5, 0), View::Point(100, 6, 1))).empty());
+    CHECK(bvh.Overlapping(View::AABB()).empty());
+}
+
+TEST_CASE("A Bvh finds the same boxes as a test of every box") {
+    const auto boxes = RandomBoxes(3000, 3);
+    const View::Bvh bvh{std::span<const View::AABB>(boxes)};
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> position(-120, 120);
+    for (int r = 0; r < 20; ++r) {
+        const View::Ray ray(
+            View::Point(position(generator), position(generator), position(generator)),
+            View::NormalizedVector(position(generator), position(generator), position(generator))
+        );
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            if (EntryOf(boxes[i], ray)) {
+                expected.push_back(i);
+            }
+        }
+        std::vector<std::size_t> found;
+        for (const auto& hit : bvh.Intersecting(ray)) {
+            found.push_back(hit.index);
+        }
+        std::sort(found.begin(), found.end());
+        CHECK(found == expected);
+    }
+}
+
+TEST_CASE("A Bvh can be refitted to moved boxes") {
+    auto boxes = RandomBoxes(500, 5);
+    View::Bvh bvh{std::span<const View::AABB>(boxes)};
+    for (auto& box : boxes) {
+        box = View::AABB(box.Min() + View::Vector(0, 0, 300), box.Max() + View::Vector(0, 0, 300));
+    }
+    bvh.Refit(boxes);
+
+    const View::AABB query(View::Point(-50, -50, 250), View::Point(50, 50, 350));
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        if (boxes[i].Overlaps(query)) {
+            expected.push_back(i);
+        }
+    }
+    CHECK(bvh.Overlapping(query) == expected);
+    CHECK(bvh.Bounds().Min().Z() > 150);
+
+    boxes.pop_back();
+    CHECK_THROWS_AS(bvh.Refit(boxes), std::invalid_argument);
+}
+
+TEST_CASE("A Bvh rejects empty boxes") {
+    const std::vector<View::AABB> boxes{View::AABB(View::Point(0, 0, 0), View::Point(1, 1, 1)), View::AABB()};
+    CHECK_THROWS_AS(View::Bvh{std::span<const View::AABB>(boxes)}, std::invalid_argument);
+    const View::Bvh empty;
+    CHECK(empty.Intersecting(View::Ray(View::Point(0, 0, 0), View::NormalizedVector(1, 0, 0))).empty());
+    CHECK(empty.Bounds().IsEmpty());
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("A Bvh can only be searched with rays and boxes from its own space") {
+    const View::Bvh bvh;
+    const Image::Ray ray(Image::Point(0, 0, 0), Image::NormalizedVector(1, 0, 0));
+    const auto intersect = [](std::size_t) { return std::optional<double>{}; };
+    using closest_type = decltype(bvh.Closest(ray, intersect));
+    using intersecting_type = decltype(bvh.Intersecting(ray));
+    using overlapping_type = decltype(bvh.Overlapping(Image::AABB()));
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<closest_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<intersecting_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<overlapping_type, required_type>));
+}
+#endif
@@ -0,0 +1,67 @@
+cmake_minimum_required(VERSION 3.20)
+
+# Compares the assembly of each kernel in TYPED with the kernel of the same name
+# in RAW. A typed kernel may not make more calls, branches or stack accesses,
+# and may use at most TOLERANCE more instructions, to allow for differences in
+# instruction scheduling and register allocation.
+if(NOT DEFINED TOLERANCE)
+    set(TOLERANCE 1)
+endif()
+
+function(count_instructions file prefix)
+    file(STRINGS ${file} lines)
+    set(kernels)
+    set(current)
+    foreach(line IN LISTS lines)
+        if(line MATCHES "^_?([A-Za-z][A-Za-z0-9_]*):")
+            set(current ${CMAKE_MATCH_1})
+            list(APPEND kernels ${current})
+            foreach(kind instructions calls branches stack)
+                set(${prefix}_${current}_${kind} 0)
+            endforeach()
+        elseif(current AND line MATCHES "^[ \t]+([a-z][a-z0-9.]*)")
+            set(mnemonic ${CMAKE_MATCH_1})
+            math(EXPR ${prefix}_${current}_instructions "${${prefix}_${current}_instructions} + 1")
+            if(mnemonic MATCHES "^(call|bl|blr)")
+                math(EXPR ${prefix}_${current}_calls "${${prefix}_${current}_calls} + 1")
+            elseif(mnemonic MATCHES "^(j[a-z]+|b|b\\.[a-z]+|cbn?z|tbn?z)$" AND NOT mnemonic STREQUAL "jmp")
+                math(EXPR ${prefix}_${current}_branches "${${prefix}_${current}_branches} + 1")
+            endif()
+            if(line MATCHES "%rsp|\\[sp")
+                math(EXPR ${prefix}_${current}_stack "${${prefix}_${current}_stack} + 1")
+            endif()
+        endif()
+    endforeach()
+    foreach(kernel IN LISTS kernels)
+        foreach(kind instructions calls branches stack)
+            set(${prefix}_${kernel}_${kind} ${${prefix}_${kernel}_${kind}} PARENT_SCOPE)
+        endforeach()
+    endforeach()
+    set(${prefix}_kernels ${kernels} PARENT_SCOPE)
+endfunction()
+
+count_instructions(${TYPED} typed)
+count_instructions(${RAW} raw)
+
+set(failures)
+foreach(kernel IN LISTS raw_kernels)
+    if(NOT kernel IN_LIST typed_kernels)
+        list(APPEND failures "${kernel}: missing from the typed kernels")
+        continue()
+    endif()
+    foreach(kind instructions calls branches stack)
+        set(allowed ${raw_${kernel}_${kind}})
+        if(kind STREQUAL "instructions")
+            math(EXPR allowed "${allowed} + ${TOLERANCE}")
+        endif()
+        if(typed_${kernel}_${kind} GREATER allowed)
+            list(APPEND failures "${kernel}: ${typed_${kernel}_${kind}} ${kind} typed, ${raw_${kernel}_${kind}} raw")
+        endif()
+    endforeach()
+    message(STATUS "${kernel}: ${typed_${kernel}_instructions} instructions typed, ${raw_${kernel}_instructions} raw")
+endforeach()
+
+if(failures)
+    list(JOIN failures "\n  " report)
+    message(FATAL_ERROR "The typed API generates more code than hand-written maths:\n  ${report}")
+endif()
@@ -0,0 +1,84 @@
+// Hand-written equivalents of the kernels in TypedKernels.cpp.
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+struct Raw {
+    double x;
+    double y;
+    double z;
+};
+
+extern "C" {
+
+void vector_add(const Raw& a, const Raw& b, Raw& out) { out = {a.x + b.x, a.y + b.y, a.z + b.z}; }
+
+void vector_sub(const Raw& a, const Raw& b, Raw& out) { out = {a.x - b.x, a.y - b.y, a.z - b.z}; }
+
+void vector_add_assign(Raw& a, const Raw& b) {
+    a.x += b.x;
+    a.y += b.y;
+    a.z += b.z;
+}
+
+void vector_chain(Raw& a, const Raw& b, const Raw& c) {
+    a.x += b.x;
+    a.y += b.y;
+    a.z += b.z;
+    a.x -= c.x;
+    a.y -= c.y;
+    a.z -= c.z;
+}
+
+void vector_scale(const Raw& a, const double d, Raw& out) { out = {a.x * d, a.y * d, a.z * d}; }
+
+void vector_scale_assign(Raw& a, const double d) {
+    a.x *= d;
+    a.y *= d;
+    a.z *= d;
+}
+
+double vector_dot(const Raw& a, const Raw& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+void vector_cross(const Raw& a, const Raw& b, Raw& out) {
+    out = {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+double vector_mag(const Raw& a) { return std::sqrt(a.x * a.x + a.y * a.y + a.z * a.z); }
+
+void point_add(const Raw& p, const Raw& v, Raw& out) { out = {p.x + v.x, p.y + v.y, p.z + v.z}; }
+
+void point_sub(const Raw& p, const Raw& q, Raw& out) { out = {p.x - q.x, p.y - q.y, p.z - q.z}; }
+
+void point_add_assign(Raw& p, const Raw& v) {
+    p.x += v.x;
+    p.y += v.y;
+    p.z += v.z;
+}
+
+double element_access(const Raw& p) { return p.x + p.y * p.z; }
+
+double indexed_access(const Raw& p) { return p.x + p.y * p.z; }
+
+double runtime_indexed_access(const Raw& p, const unsigned int i) {
+    if (i >= 3) {
+        throw std::invalid_argument("Index is out of range");
+    }
+    return (&p.x)[i];
+}
+
+void add_arrays(const Raw* a, const Raw* b, Raw* out, const std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = {a[i].x + b[i].x, a[i].y + b[i].y, a[i].z + b[i].z};
+    }
+}
+
+void translate_points(Raw* points, const Raw& v, const std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        points[i].x += v.x;
+        points[i].y += v.y;
+        points[i].z += v.z;
+    }
+}
+
+}
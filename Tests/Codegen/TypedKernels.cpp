@@ -0,0 +1,54 @@
+// Kernels written with the typed API. Each must compile to no more
+// instructions than the function of the same name in RawKernels.cpp.
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+extern "C" {
+
+void vector_add(const View::Vector& a, const View::Vector& b, View::Vector& out) { out = a + b; }
+
+void vector_sub(const View::Vector& a, const View::Vector& b, View::Vector& out) { out = a - b; }
+
+void vector_add_assign(View::Vector& a, const View::Vector& b) { a += b; }
+
+void vector_chain(View::Vector& a, const View::Vector& b, const View::Vector& c) { (a += b) -= c; }
+
+void vector_scale(const View::Vector& a, const double d, View::Vector& out) { out = a * d; }
+
+void vector_scale_assign(View::Vector& a, const double d) { a *= d; }
+
+double vector_dot(const View::Vector& a, const View::Vector& b) { return a.Dot(b); }
+
+void vector_cross(const View::Vector& a, const View::Vector& b, View::Vector& out) { out = a.Cross(b); }
+
+double vector_mag(const View::Vector& a) { return a.Mag_double(); }
+
+void point_add(const View::Point& p, const View::Vector& v, View::Point& out) { out = p + v; }
+
+void point_sub(const View::Point& p, const View::Point& q, View::Vector& out) { out = p - q; }
+
+void point_add_assign(View::Point& p, const View::Vector& v) { p += v; }
+
+double element_access(const View::Point& p) { return p.X() + p.Y() * p.at<2>(); }
+
+// operator[] checks its index and throws when it is out of range. With constant
+// indices the check folds away; with a runtime index it costs the same as the
+// check a hand-written accessor would need.
+double indexed_access(const View::Point& p) { return p[0] + p[1] * p[2]; }
+
+double runtime_indexed_access(const View::Point& p, const unsigned int i) { return p[i]; }
+
+void add_arrays(const View::Vector* a, const View::Vector* b, View::Vector* out, const std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+void translate_points(View::Point* points, const View::Vector& v, const std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        points[i] += v;
+    }
+}
+
+}
@@ -0,0 +1,62 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+constexpr View::Point origin(1, 2, 3);
+constexpr View::Vector offset(4, 5, 6);
+
+constexpr std::array<View::NormalizedVector, 3> axes{
+    View::NormalizedVector(1, 0, 0), View::NormalizedVector(0, 2, 0), View::NormalizedVector(0, 0, 3)
+};
+
+constexpr View::Point Translated(View::Point p, const View::Vector& v) {
+    p += v;
+    p -= View::Vector(0, 0, 1);
+    return p;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Points and vectors can be constant expressions") {
+    static_assert(origin.X() == 1 && origin.Y() == 2 && origin.Z() == 3);
+    static_assert(View::Point().Z() == 0);
+    static_assert(origin.at<1>() == 2);
+    static_assert(origin[2] == 3);
+    CHECK(origin == View::Point(1, 2, 3));
+}
+
+TEST_CASE("Point and vector arithmetic can be done at compile time") {
+    static_assert(origin + offset == View::Point(5, 7, 9));
+    static_assert(origin - offset == View::Point(-3, -3, -3));
+    static_assert(origin - View::Point(1, 1, 1) == View::Vector(0, 1, 2));
+    static_assert(offset * 2 == View::Vector(8, 10, 12));
+    static_assert(Translated(origin, offset) == View::Point(5, 7, 8));
+    static_assert(offset.Dot(View::Vector(1, 1, 1)) == 15);
+    static_assert(View::Vector(1, 0, 0).Cross(View::Vector(0, 1, 0)) == View::Vector(0, 0, 1));
+    static_assert(View::Vector(3, 4, 0).Mag_double() == 5);
+    CHECK(Translated(origin, offset) == View::Point(5, 7, 8));
+}
+
+TEST_CASE("Normalized vectors can be made at compile time") {
+    static_assert(axes[1] == View::NormalizedVector(0, 1, 0));
+    static_assert(axes[2].Z() == 1);
+    static_assert(View::Vector(0, 0, 5).Norm() == axes[2]);
+    static_assert(axes[0].Cross(axes[1]) == axes[2]);
+    static_assert(!View::NormalizedVector::TryMake(0, 0, 0).has_value());
+    static_assert(View::Vector(3, 0, 4).TryNorm()->Z() == 0.8);
+    CHECK(axes[0] == View::NormalizedVector(1, 0, 0));
+}
+
+TEST_CASE("XY points and vectors can be constant expressions") {
+    constexpr View::XYPoint p(1, 2);
+    constexpr View::XYVector v(3, 4);
+    static_assert(p + v == View::XYPoint(4, 6));
+    static_assert(v.Mag_double() == 5);
+    static_assert(View::NormalizedXYVector(0, 2) == View::NormalizedXYVector(0, 1));
+    static_assert(static_cast<View::Point>(p) == View::Point(1, 2, 0));
+    static_assert(origin.ToXY() == View::XYPoint(1, 2));
+    CHECK(p + v == View::XYPoint(4, 6));
+}
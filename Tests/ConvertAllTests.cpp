@@ -0,0 +1,150 @@
+#include "ExampleTransformManager.h"
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+#include <atomic>
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+namespace {
+
+/// Adds one to the first coordinate of each point, and counts the points it
+/// has converted, from any number of threads at once.
+class CountingTransformManager final {
+  public:
+    template <typename From, typename To> [[nodiscard]] TestVector TransformPoint(TestVector v) const noexcept {
+        v.m_values[0] += 1;
+        return v;
+    }
+
+    template <typename From, typename To> [[nodiscard]] TestVector TransformVector(TestVector v) const noexcept {
+        v.m_values[1] += 1;
+        return v;
+    }
+
+    template <typename From, typename To>
+    void TransformPoints(std::span<const TestVector> in, std::span<TestVector> out) const noexcept {
+        converted += in.size();
+        std::ranges::transform(in, out.begin(), [this](TestVector v) { return TransformPoint<From, To>(v); });
+    }
+
+    mutable std::atomic<std::size_t> converted = 0;
+};
+
+/// Runs every task in order on the calling thread.
+struct InOrderExecutor final {
+    template <typename Task> void ForEach(const std::size_t count, Task&& task) {
+        for (std::size_t i = 0; i < count; ++i) {
+            order.push_back(i);
+            task(i);
+        }
+    }
+
+    std::vector<std::size_t> order;
+};
+
+std::vector<View::Point> NumberedPoints(const std::size_t count) {
+    std::vector<View::Point> points;
+    points.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        points.emplace_back(static_cast<double>(i), -static_cast<double>(i), 1);
+    }
+    return points;
+}
+} // namespace
+
+TEST_CASE("Executors are detected") {
+    CHECK(Executor<WorkStealingPool>);
+    CHECK(Executor<InOrderExecutor>);
+    CHECK(!Executor<TransformManager>);
+}
+
+TEST_CASE("A work-stealing pool runs every task once") {
+    for (const std::size_t threads : {1, 2, 4}) {
+        WorkStealingPool pool(threads);
+        CHECK(pool.size() == threads);
+        for (const std::size_t count : {0, 1, 3, 1000}) {
+            std::vector<std::atomic<int>> runs(count);
+            pool.ForEach(count, [&runs](const std::size_t i) { ++runs[i]; });
+            CHECK(std::all_of(runs.begin(), runs.end(), [](const auto& r) { return r == 1; }));
+        }
+    }
+    CHECK_THROWS_WITH(WorkStealingPool(0), "A pool needs at least one thread");
+}
+
+TEST_CASE("A work-stealing pool rethrows the first exception from a task") {
+    WorkStealingPool pool(4);
+    CHECK_THROWS_WITH(
+        pool.ForEach(100, [](const std::size_t i) {
+            if (i == 42) {
+                throw std::invalid_argument("task 42");
+            }
+        }),
+        "task 42"
+    );
+
+    std::atomic<std::size_t> total = 0;
+    pool.ForEach(100, [&total](const std::size_t i) { total += i; });
+    CHECK(total == 4950);
+}
+
+TEST_CASE("Spans are converted in parallel in the same order as one at a time") {
+    const CountingTransformManager tm;
+    const auto points = NumberedPoints(100000);
+    WorkStealingPool pool(4);
+
+    const auto converted = ConvertAll<Data>(View::ConstPointSpan(points), tm, pool);
+
+    CHECK(tm.converted == points.size());
+    CHECK(converted == View::ConstPointSpan(points).ConvertTo<Data>(tm));
+    CHECK(converted[99999] == Data::Point(100000, -99999, 1));
+}
+
+TEST_CASE("Spans are converted in parallel into existing storage") {
+    TransformManager tm;
+    tm.SetDataVectorValues(1, 2, 3);
+    const std::vector<View::Vector> vectors(40000, View::Vector(4, 5, 6));
+    std::vector<TestVector> impls(vectors.size());
+    WorkStealingPool pool(3);
+
+    ConvertAll<Data>(View::ConstVectorSpan(vectors), tm, Data::VectorSpan(impls), pool);
+
+    CHECK(std::all_of(impls.begin(), impls.end(), [](const TestVector& v) {
+        return v.m_values == std::array<double, 3>{1, 2, 3};
+    }));
+
+    std::vector<TestVector> tooFew(1);
+    CHECK_THROWS_WITH(
+        ConvertAll<Data>(View::ConstVectorSpan(vectors), tm, Data::VectorSpan(tooFew), pool), "Spans must be the same size"
+    );
+}
+
+TEST_CASE("Spans are converted in blocks of the same size on any executor") {
+    const CountingTransformManager tm;
+    const auto points = NumberedPoints(40000);
+    InOrderExecutor executor;
+    WorkStealingPool pool(2);
+
+    const auto converted = ConvertAll<Data>(View::ConstPointSpan(points), tm, executor);
+
+    CHECK(executor.order == std::vector<std::size_t>{0, 1, 2});
+    CHECK(converted == ConvertAll<Data>(View::ConstPointSpan(points), tm, pool));
+
+    const std::vector<View::Point> none;
+    CHECK(ConvertAll<Data>(View::ConstPointSpan(none), tm, executor).empty());
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("Spans cannot be converted in parallel to the same space") {
+    const CountingTransformManager tm;
+    const std::vector<View::Point> points;
+    WorkStealingPool pool(1);
+    using converted_type = decltype(ConvertAll<View>(View::ConstPointSpan(points), tm, pool));
+    using required_type = StaticAssert::invalid_same_space_conversion;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type, required_type>));
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,74 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+static_assert(HasConstantId<View, SpaceIDs>);
+static_assert(View::id == SpaceIDs::View);
+
+using Conversion = TestVector (*)(const TestVector&);
+
+TestVector Unchanged(const TestVector& t) { return t; }
+
+TestVector Doubled(const TestVector& t) {
+    TestVector d;
+    d.m_values = {2 * t.m_values[0], 2 * t.m_values[1], 2 * t.m_values[2]};
+    return d;
+}
+
+TestVector Shifted(const TestVector& t) {
+    TestVector d;
+    d.m_values = {t.m_values[0] + 1, t.m_values[1] + 1, t.m_values[2] + 1};
+    return d;
+}
+
+// Looks up the conversion for each pair of spaces without branching on their ids.
+class TableTransformManager final {
+  public:
+    TableTransformManager() : points(&Unchanged), vectors(&Unchanged) {
+        points.Set<View, Image>(&Shifted);
+        vectors.Set<View, Image>(&Doubled);
+    }
+
+    template <typename From, typename To> [[nodiscard]] TestVector TransformPoint(const TestVector& t) const noexcept {
+        return points.At<From, To>()(t);
+    }
+
+    template <typename From, typename To> [[nodiscard]] TestVector TransformVector(const TestVector& t) const noexcept {
+        return vectors.At<From, To>()(t);
+    }
+
+  private:
+    DispatchTable<SpaceIDs, 4, Conversion> points;
+    DispatchTable<SpaceIDs, 4, Conversion> vectors;
+};
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("DispatchTables start with the given entry") {
+    const DispatchTable<SpaceIDs, 4, int> table(7);
+    CHECK(table.At<View, Image>() == 7);
+    CHECK(table.At<Volume, Data>() == 7);
+}
+
+TEST_CASE("DispatchTables hold an entry for each ordered pair of spaces") {
+    DispatchTable<SpaceIDs, 4, int> table;
+    table.Set<View, Image>(1);
+    table.Set<Image, View>(2);
+    table.At<Volume, Data>() = 3;
+    CHECK(table.At<View, Image>() == 1);
+    CHECK(table.At<Image, View>() == 2);
+    CHECK(table.At<Volume, Data>() == 3);
+    CHECK(table.At<Data, Volume>() == 0);
+}
+
+TEST_CASE("DispatchTables can drive a Transform Manager") {
+    const TableTransformManager tm;
+    CHECK(View::Point(1, 2, 3).ConvertTo<Image>(tm) == Image::Point(2, 3, 4));
+    CHECK(View::Vector(1, 2, 3).ConvertTo<Image>(tm) == Image::Vector(2, 4, 6));
+    CHECK(Image::Point(1, 2, 3).ConvertTo<View>(tm) == View::Point(1, 2, 3));
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -12,7 +12,7 @@ class TransformManager final {
 
     template <typename From, typename To> [[nodiscard]] TestVector TransformPoint(TestVector) const noexcept {
         using namespace Space;
-        if (From::id == SpaceIDs::View) {
+        if constexpr (From::id == SpaceIDs::View) {
             TestVector t;
             t.m_values[0] = dataPointValues[0];
             t.m_values[1] = dataPointValues[1];
@@ -35,7 +35,7 @@ class TransformManager final {
 
     template <typename From, typename To> [[nodiscard]] TestVector TransformVector(TestVector) const noexcept {
         using namespace Space;
-        if (To::id == SpaceIDs::Data) {
+        if constexpr (To::id == SpaceIDs::Data) {
             TestVector t;
             t.m_values[0] = dataVectorValues[0];
             t.m_values[1] = dataVectorValues[1];
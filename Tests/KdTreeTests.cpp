@@ -0,0 +1,135 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+#include <random>
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+namespace {
+
+std::vector<Data::Point> RandomPoints(const std::size_t count) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-100, 100);
+    std::vector<Data::Point> points;
+    points.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        points.emplace_back(distribution(generator), distribution(generator), distribution(generator));
+    }
+    return points;
+}
+
+/// Every point ordered by distance from the query, in the same order as the tree reports them.
+std::vector<Data::KdTree::Neighbour> ByDistance(const std::vector<Data::Point>& points, const Data::Point& query) {
+    std::vector<Data::KdTree::Neighbour> all;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        all.push_back({i, (points[i] - query).Mag_double()});
+    }
+    std::sort(all.begin(), all.end(), implementation::Closer<double>);
+    return all;
+}
+} // namespace
+
+TEST_CASE("A KdTree finds the nearest point") {
+    const std::vector<Data::Point> points{{0, 0, 0}, {10, 0, 0}, {0, 10, 0}, {0, 0, 10}};
+    const Data::KdTree tree{Data::ConstPointSpan(points)};
+    CHECK(tree.size() == 4);
+
+    const auto nearest = tree.Nearest(Data::Point(1, 8, 0));
+    REQUIRE(nearest);
+    CHECK(nearest->index == 2);
+    CHECK(nearest->distance == Approx(std::sqrt(5.0)));
+}
+
+TEST_CASE("An empty KdTree finds nothing") {
+    const Data::KdTree tree;
+    CHECK(tree.empty());
+    CHECK(!tree.Nearest(Data::Point(0, 0, 0)));
+    CHECK(tree.Nearest(Data::Point(0, 0, 0), 3).empty());
+    CHECK(tree.WithinRadius(Data::Point(0, 0, 0), 100).empty());
+}
+
+TEST_CASE("A KdTree finds the same neighbours as a search of every point") {
+    const auto points = RandomPoints(5000);
+    const Data::KdTree tree{Data::ConstPointSpan(points)};
+    const std::array queries{Data::Point(0, 0, 0), Data::Point(99, -99, 50), Data::Point(300, 0, 0)};
+
+    std::vector<Data::KdTree::Neighbour> found;
+    for (const auto& query : queries) {
+        const auto expected = ByDistance(points, query);
+        CHECK(tree.Nearest(query)->index == expected[0].index);
+
+        tree.Nearest(query, 10, found);
+        REQUIRE(found.size() == 10);
+        for (std::size_t i = 0; i < found.size(); ++i) {
+            CHECK(found[i].index == expected[i].index);
+            CHECK(found[i].distance == Approx(expected[i].distance));
+        }
+
+        tree.WithinRadius(query, 20, found);
+        const auto inside = std::count_if(expected.begin(), expected.end(), [](const auto& n) { return n.distance <= 20; });
+        REQUIRE(found.size() == static_cast<std::size_t>(inside));
+        for (std::size_t i = 0; i < found.size(); ++i) {
+            CHECK(found[i].index == expected[i].index);
+        }
+    }
+}
+
+TEST_CASE("A KdTree reports points at the same distance in index order") {
+    const std::vector<Data::Point> points(20, Data::Point(1, 1, 1));
+    const Data::KdTree tree{Data::ConstPointSpan(points)};
+    const auto found = tree.Nearest(Data::Point(0, 0, 0), 5);
+    REQUIRE(found.size() == 5);
+    for (std::size_t i = 0; i < found.size(); ++i) {
+        CHECK(found[i].index == i);
+    }
+    CHECK(tree.Nearest(Data::Point(0, 0, 0), 50).size() == 20);
+    CHECK(tree.Nearest(Data::Point(0, 0, 0), 0).empty());
+}
+
+TEST_CASE("A KdTree can be built from a point cloud") {
+    const auto points = RandomPoints(100);
+    Data::PointCloud cloud;
+    for (const auto& p : points) {
+        cloud.push_back(p);
+    }
+    const Data::KdTree fromCloud(cloud);
+    const Data::KdTree fromSpan{Data::ConstPointSpan(points)};
+    CHECK(fromCloud.Nearest(Data::Point(5, 5, 5), 4) == fromSpan.Nearest(Data::Point(5, 5, 5), 4));
+}
+
+TEST_CASE("A large KdTree finds the nearest points") {
+    const auto points = RandomPoints(200000);
+    const Data::KdTree tree{Data::ConstPointSpan(points)};
+    const Data::Point query(1, 2, 3);
+    const auto expected = ByDistance(points, query);
+    const auto found = tree.Nearest(query, 3);
+    REQUIRE(found.size() == 3);
+    CHECK(found[0].index == expected[0].index);
+    CHECK(found[2].index == expected[2].index);
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("A KdTree can only be searched with points from its own space") {
+    const Data::KdTree tree;
+    using nearest_type = decltype(tree.Nearest(Volume::Point()));
+    using nearest_k_type = decltype(tree.Nearest(Volume::Point(), 3));
+    using radius_type = decltype(tree.WithinRadius(Volume::Point(), 1.0));
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<nearest_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<nearest_k_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<radius_type, required_type>));
+}
+
+TEST_CASE("A KdTree can only be searched with points") {
+    const Data::KdTree tree;
+    using nearest_type = decltype(tree.Nearest(Data::Vector()));
+    using nearest_k_type = decltype(tree.Nearest(Data::NormalizedVector(), 3));
+    using radius_type = decltype(tree.WithinRadius(Data::Vector(), 1.0));
+    using required_type = StaticAssert::invalid_spatial_query;
+    CHECK(static_cast<bool>(std::is_same_v<nearest_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<nearest_k_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<radius_type, required_type>));
+}
+#endif
@@ -0,0 +1,97 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+#include "MappedFile.h"
+
+#include <fstream>
+#include <random>
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+namespace {
+
+/// A file in the temporary directory with a name no other test run uses,
+/// which is removed when it goes out of scope.
+class TemporaryFile final {
+  public:
+    explicit TemporaryFile(const std::string& bytes) : path(UniquePath()) {
+        std::ofstream(path, std::ios::binary) << bytes;
+    }
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+    ~TemporaryFile() {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+    }
+
+    const std::filesystem::path path;
+
+  private:
+    [[nodiscard]] static std::filesystem::path UniquePath() {
+        static std::mt19937_64 generator(std::random_device{}());
+        return std::filesystem::temp_directory_path() / ("space_mapped_" + std::to_string(generator()) + ".bin");
+    }
+};
+
+template <typename Range> std::string BinaryOf(const Range& elements) {
+    std::stringstream stream;
+    WriteBinary(stream, elements);
+    return stream.str();
+}
+} // namespace
+
+TEST_CASE("A binary file can be mapped as a span of points") {
+    const std::vector<Volume::Point> points{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+    const TemporaryFile temporary(BinaryOf(points));
+
+    const MappedFile<Volume::Point> file(temporary.path);
+    const Volume::ConstPointSpan mapped = file.Elements();
+    CHECK(file.size() == 3);
+    CHECK(mapped[0] == Volume::Point(1, 2, 3));
+    CHECK(mapped[2] == Volume::Point(7, 8, 9));
+
+    const AffineTransform<Volume, Data> t({{{1, 0, 0, 1}, {0, 1, 0, 1}, {0, 0, 1, 1}}});
+    std::vector<Data::Point> converted(3);
+    t.Apply(mapped, Data::PointSpan(converted));
+    CHECK(converted[2] == Data::Point(8, 9, 10));
+}
+
+TEST_CASE("Mapped files keep their elements when moved") {
+    const TemporaryFile temporary(BinaryOf(std::vector<Data::Vector>(1000, Data::Vector(1, 2, 3))));
+    MappedFile<Data::Vector> file(temporary.path);
+    const MappedFile<Data::Vector> moved(std::move(file));
+    CHECK(moved.size() == 1000);
+    CHECK(moved.Elements()[999] == Data::Vector(1, 2, 3));
+}
+
+TEST_CASE("Only packed points and vectors which aren't normalized can be mapped") {
+    CHECK(implementation::MappableElement<View::Point>);
+    CHECK(implementation::MappableElement<Data::Vector>);
+    CHECK(!implementation::MappableElement<View::NormalizedVector>);
+    CHECK(!implementation::MappableElement<Data::NormalizedVector>);
+    CHECK(!implementation::MappableElement<View::XYPoint>);
+}
+
+TEST_CASE("A file can only be mapped as the space and type it was written for") {
+    const TemporaryFile temporary(BinaryOf(std::vector<View::Point>(2)));
+    CHECK_THROWS_WITH(MappedFile<Data::Point>(temporary.path), "The data belongs to a different space");
+    CHECK_THROWS_WITH(MappedFile<View::Vector>(temporary.path), "The data holds a different type of point or vector");
+}
+
+TEST_CASE("Truncated and missing files cannot be mapped") {
+    const std::string bytes = BinaryOf(std::vector<Volume::Point>(2));
+    const TemporaryFile truncated(bytes.substr(0, bytes.size() - 1));
+    CHECK_THROWS_WITH(MappedFile<Volume::Point>(truncated.path), "The data ends before all of its elements");
+
+    const TemporaryFile empty("");
+    CHECK_THROWS_WITH(MappedFile<Volume::Point>(empty.path), "The data ends before the binary header");
+
+    std::filesystem::path missing;
+    {
+        const TemporaryFile removed("");
+        missing = removed.path;
+    }
+    CHECK(!std::filesystem::exists(missing));
+    CHECK_THROWS_AS(MappedFile<Volume::Point>(missing), std::system_error);
+}
@@ -0,0 +1,135 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+#include <random>
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+namespace {
+
+/// A box with one cell per unit along each axis.
+const View::AABB cells(View::Point(0, 0, 0), View::Point(2097152, 2097152, 2097152));
+const View::XYAABB xyCells(View::XYPoint(0, 0), View::XYPoint(4294967296.0, 4294967296.0));
+
+std::vector<View::Point> RandomPoints(const std::size_t count) {
+    std::mt19937 generator(9);
+    std::uniform_real_distribution<double> distribution(-10, 10);
+    std::vector<View::Point> points;
+    for (std::size_t i = 0; i < count; ++i) {
+        points.emplace_back(distribution(generator), distribution(generator), distribution(generator));
+    }
+    return points;
+}
+} // namespace
+
+TEST_CASE("Morton codes interleave the bits of the cell of a point") {
+    CHECK(MortonCode(View::Point(0, 0, 0), cells) == 0);
+    CHECK(MortonCode(View::Point(1, 0, 0), cells) == 1);
+    CHECK(MortonCode(View::Point(0, 1, 0), cells) == 2);
+    CHECK(MortonCode(View::Point(0, 0, 1), cells) == 4);
+    CHECK(MortonCode(View::Point(3, 3, 3), cells) == 63);
+    CHECK(MortonCode(View::Point(2.5, 0, 0), cells) == 8);
+    CHECK(MortonCode(View::Point(2097152, 2097152, 2097152), cells) == (std::uint64_t{1} << 63) - 1);
+
+    CHECK(MortonCode(View::XYPoint(1, 0), xyCells) == 1);
+    CHECK(MortonCode(View::XYPoint(0, 1), xyCells) == 2);
+    CHECK(MortonCode(View::XYPoint(2, 3), xyCells) == 14);
+    CHECK(MortonCode(View::XYPoint(4294967296.0, 4294967296.0), xyCells) == ~std::uint64_t{0});
+}
+
+TEST_CASE("Morton codes put points outside the box in the nearest cell") {
+    const View::AABB box(View::Point(0, 0, 0), View::Point(1, 1, 1));
+    CHECK(MortonCode(View::Point(-5, 0, 0), box) == 0);
+    CHECK(MortonCode(View::Point(5, 0, 0), box) == MortonCode(View::Point(1, 0, 0), box));
+
+    // A flat box puts every point in the first cell along that axis.
+    const View::AABB flat(View::Point(0, 0, 0), View::Point(1, 1, 0));
+    CHECK(MortonCode(View::Point(0, 0, 7), flat) == 0);
+
+    CHECK_THROWS_AS(MortonCode(View::Point(0, 0, 0), View::AABB()), std::invalid_argument);
+}
+
+TEST_CASE("Morton codes of a span match those of each point") {
+    const auto points = RandomPoints(103);
+    const auto box = Bounds(View::ConstPointSpan(points));
+    std::vector<std::uint64_t> codes(points.size());
+    MortonCodes(View::ConstPointSpan(points), box, codes);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        CHECK(codes[i] == MortonCode(points[i], box));
+    }
+
+    std::vector<std::uint64_t> tooFew(3);
+    CHECK_THROWS_AS(MortonCodes(View::ConstPointSpan(points), box, tooFew), std::invalid_argument);
+}
+
+TEST_CASE("Points can be sorted into Morton order") {
+    auto points = RandomPoints(1000);
+    points.push_back(points[10]);
+    const auto original = points;
+    const auto box = Bounds(View::ConstPointSpan(points));
+
+    const auto order = SortByMorton(View::PointSpan(points), box);
+    REQUIRE(order.size() == original.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        CHECK(points[i] == original[order[i]]);
+    }
+    for (std::size_t i = 1; i < points.size(); ++i) {
+        CHECK(MortonCode(points[i - 1], box) <= MortonCode(points[i], box));
+    }
+    // Points with the same code keep their order.
+    const auto first = std::find(order.begin(), order.end(), 10);
+    CHECK(std::find(first, order.end(), 1000) != order.end());
+}
+
+TEST_CASE("XY points can be sorted into Morton order") {
+    std::vector<View::XYPoint> points{{3, 3}, {0, 0}, {1, 2}, {2, 1}, {0, 3}};
+    const View::XYAABB box(View::XYPoint(0, 0), View::XYPoint(4, 4));
+    const auto order = SortByMorton(implementation::Span<View::XYPoint>(points), box);
+    CHECK(order == std::vector<std::size_t>{1, 3, 2, 4, 0});
+    CHECK(points.front() == View::XYPoint(0, 0));
+}
+
+TEST_CASE("A large set of points can be sorted into Morton order") {
+    auto points = RandomPoints(200000);
+    const auto box = Bounds(View::ConstPointSpan(points));
+    SortByMorton(View::PointSpan(points), box);
+    std::vector<std::uint64_t> codes(points.size());
+    MortonCodes(View::ConstPointSpan(points), box, codes);
+    CHECK(std::is_sorted(codes.begin(), codes.end()));
+}
+
+TEST_CASE("Sorting by Morton order moves every point to its place") {
+    const auto original = RandomPoints(1000);
+    auto points = original;
+    const auto box = Bounds(View::ConstPointSpan(points));
+    const auto order = SortByMorton(View::PointSpan(points), box);
+    REQUIRE(order.size() == points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        CHECK(points[i] == original[order[i]]);
+    }
+    auto sortedOrder = order;
+    std::sort(sortedOrder.begin(), sortedOrder.end());
+    CHECK(std::adjacent_find(sortedOrder.begin(), sortedOrder.end()) == sortedOrder.end());
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("Morton codes can only be found in a box from the same space") {
+    std::vector<Image::Point> images;
+    using code_type = decltype(MortonCode(Image::Point(), cells));
+    using sort_type = decltype(SortByMorton(Image::PointSpan(images), cells));
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<code_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<sort_type, required_type>));
+}
+
+TEST_CASE("Morton codes can only be found in a box of the same dimensions") {
+    std::vector<View::XYPoint> xyPoints;
+    using code_type = decltype(MortonCode(View::XYPoint(), cells));
+    using sort_type = decltype(SortByMorton(implementation::Span<View::XYPoint>(xyPoints), cells));
+    using required_type = StaticAssert::invalid_bounds_dimensions;
+    CHECK(static_cast<bool>(std::is_same_v<code_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<sort_type, required_type>));
+}
+#endif
@@ -754,7 +754,7 @@ TEST_CASE("NormalizedVectors can format the default-formatting") {
 
 TEST_CASE("NormalizedVectors can localise the default-formatting") {
     const View::NormalizedVector v(1, 1, 0);
-    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{}", v);
+    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{:L}", v);
     CHECK(localised.contains("0,707"));
     CHECK(!localised.contains("0.707"));
 }
@@ -843,3 +843,24 @@ TEST_CASE("NormalizedVectors can be printed") {
     std::print(stream, "{}", v);
     CHECK(stream.str() == "View::NormalizedVector (1, 0, 0)");
 }
+
+TEST_CASE("NormalizedVectors can be made without throwing") {
+    const auto v = View::NormalizedVector::TryMake(0, 3, 4);
+    REQUIRE(v.has_value());
+    CHECK(v->X() == 0);
+    CHECK(v->Y() == 3.0 / 5);
+    CHECK(v->Z() == 4.0 / 5);
+}
+
+TEST_CASE("NormalizedVectors can be made from implementation without throwing") {
+    TestVector t;
+    t.m_values = {2, 0, 0};
+    const auto v = View::NormalizedVector::TryMake(t);
+    REQUIRE(v.has_value());
+    CHECK(*v == View::NormalizedVector(1, 0, 0));
+}
+
+TEST_CASE("NormalizedVectors cannot be made from zero size vectors") {
+    CHECK_FALSE(View::NormalizedVector::TryMake(0, 0, 0).has_value());
+    CHECK_FALSE(View::NormalizedVector::TryMake(TestVector{}).has_value());
+}
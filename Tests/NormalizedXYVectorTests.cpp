@@ -753,7 +753,7 @@ TEST_CASE("NormalizedXYVectors can format the default-formatting") {
 
 TEST_CASE("NormalizedXYVectors can localise the default-formatting") {
     const View::NormalizedXYVector v(1, 1);
-    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{}", v);
+    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{:L}", v);
     CHECK(localised.contains("0,707"));
     CHECK(!localised.contains("0.707"));
 }
@@ -811,3 +811,25 @@ TEST_CASE("NormalizedXYVectors can be printed") {
     std::print(stream, "{}", v);
     CHECK(stream.str() == "View::NormalizedXYVector (1, 0)");
 }
+
+TEST_CASE("NormalizedXYVectors can be made without throwing") {
+    const auto v = View::NormalizedXYVector::TryMake(3, 4);
+    REQUIRE(v.has_value());
+    CHECK(v->X() == 3.0 / 5);
+    CHECK(v->Y() == 4.0 / 5);
+}
+
+TEST_CASE("NormalizedXYVectors ignore z when made from implementation without throwing") {
+    TestVector t;
+    t.m_values = {0, 2, 7};
+    const auto v = View::NormalizedXYVector::TryMake(t);
+    REQUIRE(v.has_value());
+    CHECK(*v == View::NormalizedXYVector(0, 1));
+}
+
+TEST_CASE("NormalizedXYVectors cannot be made from zero size vectors") {
+    CHECK_FALSE(View::NormalizedXYVector::TryMake(0, 0).has_value());
+    TestVector t;
+    t.m_values = {0, 0, 7};
+    CHECK_FALSE(View::NormalizedXYVector::TryMake(t).has_value());
+}
@@ -0,0 +1,157 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+#include <random>
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+namespace {
+
+const Volume::AABB cube(Volume::Point(0, 0, 0), Volume::Point(64, 64, 64));
+
+Volume::Point RandomPoint(std::mt19937& generator) {
+    std::uniform_real_distribution<double> distribution(0, 64);
+    return Volume::Point(distribution(generator), distribution(generator), distribution(generator));
+}
+} // namespace
+
+TEST_CASE("An octree finds the points in a box and within a radius") {
+    Volume::Octree octree(cube);
+    const auto a = octree.Insert(Volume::Point(1, 1, 1));
+    const auto b = octree.Insert(Volume::Point(2, 1, 1));
+    const auto c = octree.Insert(Volume::Point(60, 60, 60));
+    CHECK(octree.size() == 3);
+    CHECK(octree.Position(b) == Volume::Point(2, 1, 1));
+
+    CHECK(octree.Within(Volume::AABB(Volume::Point(0, 0, 0), Volume::Point(2, 2, 2))) == std::vector<std::size_t>{a, b});
+    CHECK(octree.Within(Volume::AABB(Volume::Point(50, 50, 50), Volume::Point(64, 64, 64))) == std::vector<std::size_t>{c});
+    CHECK(octree.Within(Volume::AABB()).empty());
+
+    const auto near = octree.WithinRadius(Volume::Point(1.9, 1, 1), Voxels(1));
+    REQUIRE(near.size() == 2);
+    CHECK(near[0].index == b);
+    CHECK(near[0].distance == Approx(0.1));
+    CHECK(near[1].index == a);
+    CHECK(octree.WithinRadius(Volume::Point(32, 32, 32), Voxels(-1)).empty());
+}
+
+TEST_CASE("An octree rejects points outside its bounds") {
+    CHECK_THROWS_AS(Volume::Octree(Volume::AABB()), std::invalid_argument);
+
+    Volume::Octree octree(cube);
+    CHECK_THROWS_AS(octree.Insert(Volume::Point(65, 0, 0)), std::invalid_argument);
+    CHECK_NOTHROW(octree.Insert(Volume::Point(64, 64, 64)));
+    CHECK_THROWS_AS(octree.Remove(7), std::invalid_argument);
+}
+
+TEST_CASE("An octree keeps its answers as points are inserted and removed") {
+    std::mt19937 generator(1);
+    Volume::Octree octree(cube);
+    std::vector<Volume::Point> points;
+    std::vector<std::size_t> ids;
+    for (int i = 0; i < 3000; ++i) {
+        points.push_back(RandomPoint(generator));
+        ids.push_back(octree.Insert(points.back()));
+    }
+    // Remove most of the points so that nodes merge, then add some back.
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        if (i % 10 != 0) {
+            octree.Remove(ids[i]);
+        }
+    }
+    std::vector<std::pair<std::size_t, Volume::Point>> remaining;
+    for (std::size_t i = 0; i < points.size(); i += 10) {
+        remaining.emplace_back(ids[i], points[i]);
+    }
+    for (int i = 0; i < 200; ++i) {
+        const auto p = RandomPoint(generator);
+        remaining.emplace_back(octree.Insert(p), p);
+    }
+    CHECK(octree.size() == remaining.size());
+
+    const Volume::Point query(20, 30, 40);
+    std::vector<std::size_t> expected;
+    for (const auto& [id, p] : remaining) {
+        if ((p - query).Mag_double() <= 12) {
+            expected.push_back(id);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    std::vector<std::size_t> found;
+    for (const auto& neighbour : octree.WithinRadius(query, Voxels(12))) {
+        found.push_back(neighbour.index);
+    }
+    std::sort(found.begin(), found.end());
+    CHECK(found == expected);
+
+    const Volume::AABB box(Volume::Point(10, 10, 10), Volume::Point(30, 40, 50));
+    expected.clear();
+    for (const auto& [id, p] : remaining) {
+        if (box.Contains(p)) {
+            expected.push_back(id);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    CHECK(octree.Within(box) == expected);
+
+    for (const auto& [id, p] : remaining) {
+        octree.Remove(id);
+    }
+    CHECK(octree.empty());
+    CHECK(octree.Within(cube).empty());
+    std::size_t leaves = 0;
+    octree.VisitLeaves([&](const Volume::AABB&, std::span<const std::size_t>) { ++leaves; });
+    CHECK(leaves == 0);
+}
+
+TEST_CASE("An octree visits its leaves in Morton order") {
+    std::mt19937 generator(2);
+    Volume::Octree octree(cube);
+    for (int i = 0; i < 1000; ++i) {
+        octree.Insert(RandomPoint(generator));
+    }
+
+    std::size_t visited = 0;
+    std::vector<Volume::AABB> leaves;
+    octree.VisitLeaves([&](const Volume::AABB& leaf, std::span<const std::size_t> ids) {
+        for (const auto id : ids) {
+            CHECK(leaf.Contains(octree.Position(id)));
+        }
+        visited += ids.size();
+        leaves.push_back(leaf);
+    });
+    CHECK(visited == 1000);
+    REQUIRE(leaves.size() > 8);
+
+    // In Morton order, the first octant along X, Y and Z comes before the others.
+    const auto firstOctant = [](const Volume::AABB& leaf) {
+        return leaf.Max().X() <= 32 && leaf.Max().Y() <= 32 && leaf.Max().Z() <= 32;
+    };
+    const auto firstOutside = std::find_if_not(leaves.begin(), leaves.end(), firstOctant);
+    CHECK(std::none_of(firstOutside, leaves.end(), firstOctant));
+    CHECK(firstOctant(leaves.front()));
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("An Octree only holds and finds points from its own space") {
+    Volume::Octree octree(Volume::AABB(Volume::Point(0, 0, 0), Volume::Point(1, 1, 1)));
+    using insert_type = decltype(octree.Insert(Data::Point()));
+    using within_type = decltype(octree.Within(Data::AABB()));
+    using radius_type = decltype(octree.WithinRadius(Data::Point(), Voxels(1)));
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<insert_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<within_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<radius_type, required_type>));
+}
+
+TEST_CASE("An Octree only holds points") {
+    Volume::Octree octree(Volume::AABB(Volume::Point(0, 0, 0), Volume::Point(1, 1, 1)));
+    using insert_type = decltype(octree.Insert(Volume::Vector()));
+    using radius_type = decltype(octree.WithinRadius(Volume::NormalizedVector(), Voxels(1)));
+    using required_type = StaticAssert::invalid_spatial_query;
+    CHECK(static_cast<bool>(std::is_same_v<insert_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<radius_type, required_type>));
+}
+#endif
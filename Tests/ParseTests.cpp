@@ -0,0 +1,59 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Points and vectors can be parsed from their serialised form") {
+    CHECK(Parse<View::Point>("View::Point (1, 2, 3)") == View::Point(1, 2, 3));
+    CHECK(Parse<View::Vector>("View::Vector (-1.5, 2e3, 0.25)") == View::Vector(-1.5, 2000, 0.25));
+    CHECK(Parse<View::XYPoint>("View::XYPoint (1, 2)") == View::XYPoint(1, 2));
+    CHECK(Parse<View::XYVector>("  View::XYVector (1,2)\r") == View::XYVector(1, 2));
+    CHECK(Parse<View::NormalizedVector>("View::NormalizedVector (0, 0, 1)") == View::NormalizedVector(0, 0, 1));
+    CHECK(Parse<View::NormalizedXYVector>("View::NormalizedXYVector (0, 1)") == View::NormalizedXYVector(0, 1));
+}
+
+TEST_CASE("Parsing reads back what is formatted") {
+    const View::Point p(0.1, -2.75, 1e-12);
+    CHECK(Parse<View::Point>(std::format("{}", p)) == p);
+
+    std::stringstream stream;
+    stream << Image::NormalizedVector(1, 2, 3);
+    CHECK(Parse<Image::NormalizedVector>(stream.str()) == Image::NormalizedVector(1, 2, 3));
+}
+
+TEST_CASE("Parsing fails for other spaces and types") {
+    CHECK(!Parse<View::Point>("Image::Point (1, 2, 3)").has_value());
+    CHECK(!Parse<View::Point>("View::Vector (1, 2, 3)").has_value());
+    CHECK(!Parse<View::Vector>("View::XYVector (1, 2)").has_value());
+    CHECK(!Parse<View::XYPoint>("View::Point (1, 2, 3)").has_value());
+}
+
+TEST_CASE("Parsing fails for malformed text") {
+    CHECK(!Parse<View::Point>("").has_value());
+    CHECK(!Parse<View::Point>("View::Point (1, 2)").has_value());
+    CHECK(!Parse<View::Point>("View::Point (1, 2, 3, 4)").has_value());
+    CHECK(!Parse<View::Point>("View::Point (1, 2, 3").has_value());
+    CHECK(!Parse<View::Point>("View::Point (1, x, 3)").has_value());
+    CHECK(!Parse<View::Point>("View::Point (1, 2, 3) trailing").has_value());
+    CHECK(!Parse<View::NormalizedVector>("View::NormalizedVector (0, 0, 0)").has_value());
+}
+
+TEST_CASE("A buffer of lines can be parsed into a container") {
+    const std::string_view text = "View::Point (1, 2, 3)\n"
+                                  "\n"
+                                  "View::Point (4, 5, 6)\r\n"
+                                  "View::Point (7, 8, 9)";
+    std::vector<View::Point> points{View::Point(0, 0, 0)};
+    CHECK(ParseAll(text, points) == 3);
+    CHECK(points.size() == 4);
+    CHECK(points[1] == View::Point(1, 2, 3));
+    CHECK(points[3] == View::Point(7, 8, 9));
+}
+
+TEST_CASE("Parsing a buffer throws at the first invalid line") {
+    std::vector<View::Vector> vectors;
+    CHECK_THROWS_WITH(ParseAll("View::Vector (1, 2, 3)\nView::Point (1, 2, 3)\n", vectors), "Line 2 could not be parsed");
+    CHECK(vectors.size() == 1);
+}
@@ -0,0 +1,329 @@
+#include "ExampleTransformManager.h"
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+TEST_CASE("PointClouds are empty by default") {
+    const View::PointCloud cloud;
+    CHECK(cloud.empty());
+    CHECK(cloud.size() == 0);
+}
+
+TEST_CASE("PointClouds can be created with a size") {
+    const View::PointCloud cloud(3);
+    CHECK(cloud.size() == 3);
+    CHECK(cloud[2] == View::Point(0, 0, 0));
+}
+
+TEST_CASE("PointClouds can be created using initalizer lists") {
+    const View::PointCloud cloud{{1, 2, 3}, {4, 5, 6}};
+    CHECK(cloud.size() == 2);
+    CHECK(cloud[0] == View::Point(1, 2, 3));
+    CHECK(cloud[1] == View::Point(4, 5, 6));
+}
+
+TEST_CASE("PointClouds can have points pushed back") {
+    View::PointCloud cloud;
+    cloud.push_back(View::Point(1, 2, 3));
+    CHECK(cloud.size() == 1);
+    CHECK(cloud[0] == View::Point(1, 2, 3));
+}
+
+TEST_CASE("PointClouds store each coordinate in its own column") {
+    const View::PointCloud cloud{{1, 2, 3}, {4, 5, 6}};
+    CHECK(std::ranges::equal(cloud.Xs(), std::vector<double>{1, 4}));
+    CHECK(std::ranges::equal(cloud.Ys(), std::vector<double>{2, 5}));
+    CHECK(std::ranges::equal(cloud.Zs(), std::vector<double>{3, 6}));
+}
+
+TEST_CASE("PointCloud columns can be modified") {
+    View::PointCloud cloud{{1, 2, 3}, {4, 5, 6}};
+    std::ranges::fill(cloud.Ys(), 7);
+    CHECK(cloud[0] == View::Point(1, 7, 3));
+    CHECK(cloud[1] == View::Point(4, 7, 6));
+}
+
+TEST_CASE("PointCloud elements support element access by name") {
+    View::PointCloud cloud{{1, 2, 3}};
+    CHECK(cloud[0].X() == 1);
+    CHECK(cloud[0].Y() == 2);
+    CHECK(cloud[0].Z() == 3);
+}
+
+TEST_CASE("PointCloud elements can be modified by name") {
+    View::PointCloud cloud{{1, 2, 3}};
+    cloud[0].SetX(10);
+    cloud[0].SetY(20);
+    cloud[0].SetZ(30);
+    CHECK(cloud[0] == View::Point(10, 20, 30));
+}
+
+TEST_CASE("PointCloud elements can be assigned from points") {
+    View::PointCloud cloud(2);
+    cloud[1] = View::Point(1, 2, 3);
+    CHECK(cloud[0] == View::Point(0, 0, 0));
+    CHECK(cloud[1] == View::Point(1, 2, 3));
+}
+
+TEST_CASE("PointCloud elements can be assigned from other elements") {
+    View::PointCloud cloud{{1, 2, 3}, {4, 5, 6}};
+    cloud[0] = cloud[1];
+    CHECK(cloud[0] == View::Point(4, 5, 6));
+}
+
+TEST_CASE("PointCloud elements convert to points") {
+    View::PointCloud cloud{{1, 2, 3}};
+    const View::Point p = cloud[0];
+    CHECK(p == View::Point(1, 2, 3));
+}
+
+TEST_CASE("PointCloud elements can have vectors added") {
+    View::PointCloud cloud{{1, 2, 3}};
+    const auto p = cloud[0] + View::Vector(1, 1, 1);
+    CHECK(p == View::Point(2, 3, 4));
+}
+
+TEST_CASE("PointCloud elements can have vectors added in place") {
+    View::PointCloud cloud{{1, 2, 3}};
+    cloud[0] += View::Vector(1, 1, 1);
+    CHECK(cloud[0] == View::Point(2, 3, 4));
+}
+
+TEST_CASE("PointCloud elements can have vectors subtracted in place") {
+    View::PointCloud cloud{{1, 2, 3}};
+    cloud[0] -= View::Vector(1, 1, 1);
+    CHECK(cloud[0] == View::Point(0, 1, 2));
+}
+
+TEST_CASE("PointCloud elements can be subtracted from each other") {
+    View::PointCloud cloud{{1, 2, 3}, {4, 6, 8}};
+    const auto v = cloud[1] - cloud[0];
+    CHECK(v == View::Vector(3, 4, 5));
+}
+
+TEST_CASE("PointClouds can be iterated") {
+    View::PointCloud cloud{{1, 2, 3}, {4, 5, 6}};
+    for (auto p : cloud) {
+        p += View::Vector(1, 0, 0);
+    }
+    CHECK(cloud[0] == View::Point(2, 2, 3));
+    CHECK(cloud[1] == View::Point(5, 5, 6));
+}
+
+TEST_CASE("Const PointClouds can be iterated") {
+    const View::PointCloud cloud{{1, 2, 3}, {4, 5, 6}};
+    std::vector<View::Point> points;
+    for (const auto p : cloud) {
+        points.push_back(p);
+    }
+    CHECK(points == std::vector<View::Point>{{1, 2, 3}, {4, 5, 6}});
+}
+
+TEST_CASE("PointClouds can be translated by a vector") {
+    View::PointCloud cloud{{1, 2, 3}, {4, 5, 6}};
+    cloud += View::Vector(1, 2, 3);
+    CHECK(cloud[0] == View::Point(2, 4, 6));
+    CHECK(cloud[1] == View::Point(5, 7, 9));
+}
+
+TEST_CASE("PointClouds can be translated by an XYVector") {
+    View::PointCloud cloud{{1, 2, 3}};
+    cloud -= View::XYVector(1, 2);
+    CHECK(cloud[0] == View::Point(0, 0, 3));
+}
+
+TEST_CASE("PointClouds can have VectorClouds added element-wise") {
+    View::PointCloud cloud{{1, 2, 3}, {4, 5, 6}};
+    const View::VectorCloud offsets{{1, 0, 0}, {0, 1, 0}};
+    cloud += offsets;
+    CHECK(cloud[0] == View::Point(2, 2, 3));
+    CHECK(cloud[1] == View::Point(4, 6, 6));
+}
+
+TEST_CASE("PointClouds throw if element-wise clouds have different sizes") {
+    View::PointCloud cloud{{1, 2, 3}};
+    const View::VectorCloud offsets{{1, 0, 0}, {0, 1, 0}};
+    CHECK_THROWS_WITH(cloud -= offsets, "Clouds must be the same size");
+}
+
+TEST_CASE("VectorClouds can be scaled") {
+    View::VectorCloud cloud{{1, 2, 3}, {4, 5, 6}};
+    cloud *= 2;
+    CHECK(cloud[0] == View::Vector(2, 4, 6));
+    CHECK(cloud[1] == View::Vector(8, 10, 12));
+}
+
+TEST_CASE("VectorCloud elements behave like vectors") {
+    View::VectorCloud cloud{{1, 0, 0}, {0, 1, 0}};
+    CHECK(cloud[0].Dot(cloud[1]) == 0);
+    CHECK(cloud[0].Cross(cloud[1]) == View::Vector(0, 0, 1));
+    CHECK(cloud[1].Mag_double() == 1);
+    cloud[0] *= 3;
+    CHECK(cloud[0] == View::Vector(3, 0, 0));
+}
+
+TEST_CASE("PointClouds can be converted to other spaces") {
+    TransformManager tm;
+    tm.SetDataPointValues(1, 2, 3);
+    const View::PointCloud cloud{{4, 5, 6}, {7, 8, 9}};
+    const Data::PointCloud converted = cloud.ConvertTo<Data>(tm);
+    CHECK(converted.size() == 2);
+    CHECK(converted[0] == Data::Point(1, 2, 3));
+    CHECK(converted[1] == Data::Point(1, 2, 3));
+}
+
+TEST_CASE("XYPointClouds only store x and y columns") {
+    View::XYPointCloud cloud{{1, 2}, {3, 4}};
+    CHECK(std::ranges::equal(cloud.Xs(), std::vector<double>{1, 3}));
+    CHECK(std::ranges::equal(cloud.Ys(), std::vector<double>{2, 4}));
+    CHECK(cloud[1] == View::XYPoint(3, 4));
+    CHECK(cloud[1].X() == 3);
+    CHECK(cloud[1].Y() == 4);
+}
+
+TEST_CASE("XYPointClouds can be translated by XYVectors") {
+    View::XYPointCloud cloud{{1, 2}, {3, 4}};
+    cloud += View::XYVector(1, 1);
+    const View::XYVectorCloud offsets{{1, 0}, {0, 1}};
+    cloud -= offsets;
+    CHECK(cloud[0] == View::XYPoint(1, 3));
+    CHECK(cloud[1] == View::XYPoint(4, 4));
+}
+
+TEST_CASE("PointClouds can have XYVectorClouds added element-wise") {
+    View::PointCloud cloud{{1, 2, 3}};
+    const View::XYVectorCloud offsets{{1, 1}};
+    cloud += offsets;
+    CHECK(cloud[0] == View::Point(2, 3, 3));
+}
+
+TEST_CASE("XYPointCloud elements convert to points") {
+    View::XYPointCloud cloud{{1, 2}};
+    const View::Point p = View::XYPoint(cloud[0]);
+    CHECK(p == View::Point(1, 2, 0));
+    CHECK(cloud[0] - View::XYPoint(1, 1) == View::XYVector(0, 1));
+}
+
+TEST_CASE("XYPointClouds are converted to 3D PointClouds in other spaces") {
+    const AffineTransform<View, Image> t({{{1, 0, 0, 0}, {0, 1, 0, 0}, {1, 1, 1, 5}}});
+    const View::XYPointCloud cloud{{1, 2}, {3, 4}};
+    const Image::PointCloud converted = cloud.ConvertTo<Image>(t);
+    CHECK(converted[0] == Image::Point(1, 2, 8));
+    CHECK(converted[1] == Image::Point(3, 4, 12));
+}
+
+TEST_CASE("XYVectorClouds are converted to 3D VectorClouds in other spaces") {
+    const AffineTransform<View, Image> t({{{1, 0, 0, 0}, {0, 1, 0, 0}, {1, 1, 1, 5}}});
+    const View::XYVectorCloud cloud{{1, 2}};
+    const Image::VectorCloud converted = cloud.ConvertTo<Image>(t);
+    CHECK(converted[0] == Image::Vector(1, 2, 3));
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("PointClouds cannot be translated by vectors from different spaces") {
+    View::PointCloud cloud;
+    const Image::Vector v;
+    const Image::VectorCloud vs;
+
+    using converted_type_1 = decltype(cloud += v);
+    using converted_type_2 = decltype(cloud -= v);
+    using converted_type_3 = decltype(cloud += vs);
+    using converted_type_4 = decltype(cloud -= vs);
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_1, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_2, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_3, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_4, required_type>));
+}
+
+TEST_CASE("PointCloud elements cannot interact with vectors from different spaces") {
+    View::PointCloud cloud(1);
+    const Image::Vector v;
+
+    using converted_type_1 = decltype(cloud[0] += v);
+    using converted_type_2 = decltype(cloud[0] + v);
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_1, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_2, required_type>));
+}
+
+TEST_CASE("PointClouds cannot have points added") {
+    View::PointCloud cloud;
+    const View::Point p;
+    const View::PointCloud ps;
+
+    using converted_type_1 = decltype(cloud += p);
+    using converted_type_2 = decltype(cloud += ps);
+    using converted_type_3 = decltype(cloud[0] += p);
+    using required_type = StaticAssert::invalid_point_to_point_addition;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_1, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_2, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_3, required_type>));
+}
+
+TEST_CASE("PointClouds cannot have points subtracted in place") {
+    View::PointCloud cloud;
+    const View::Point p;
+    const View::PointCloud ps;
+
+    using converted_type_1 = decltype(cloud -= p);
+    using converted_type_2 = decltype(cloud -= ps);
+    using required_type = StaticAssert::invalid_point_from_point_subtraction;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_1, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_2, required_type>));
+}
+
+TEST_CASE("VectorClouds cannot have points added or subtracted") {
+    View::VectorCloud cloud;
+    const View::Point p;
+    const View::PointCloud ps;
+
+    using added_type_1 = decltype(cloud += p);
+    using added_type_2 = decltype(cloud += ps);
+    using subtracted_type_1 = decltype(cloud -= p);
+    using subtracted_type_2 = decltype(cloud -= ps);
+    CHECK(static_cast<bool>(std::is_same_v<added_type_1, StaticAssert::invalid_point_to_vector_addition>));
+    CHECK(static_cast<bool>(std::is_same_v<added_type_2, StaticAssert::invalid_point_to_vector_addition>));
+    CHECK(static_cast<bool>(std::is_same_v<subtracted_type_1, StaticAssert::invalid_point_from_vector_subtraction>));
+    CHECK(static_cast<bool>(std::is_same_v<subtracted_type_2, StaticAssert::invalid_point_from_vector_subtraction>));
+}
+
+TEST_CASE("XYPointClouds cannot be translated by 3D vectors") {
+    View::XYPointCloud cloud;
+    const View::Vector v;
+    const View::VectorCloud vs;
+
+    using added_type_1 = decltype(cloud += v);
+    using added_type_2 = decltype(cloud += vs);
+    using subtracted_type_1 = decltype(cloud -= v);
+    using subtracted_type_2 = decltype(cloud -= vs);
+    CHECK(static_cast<bool>(std::is_same_v<added_type_1, StaticAssert::invalid_vector3_to_xy_point_addition>));
+    CHECK(static_cast<bool>(std::is_same_v<added_type_2, StaticAssert::invalid_vector3_to_xy_point_addition>));
+    CHECK(static_cast<bool>(std::is_same_v<subtracted_type_1, StaticAssert::invalid_vector3_from_xy_point_subtraction>));
+    CHECK(static_cast<bool>(std::is_same_v<subtracted_type_2, StaticAssert::invalid_vector3_from_xy_point_subtraction>));
+}
+
+TEST_CASE("XYVectorClouds cannot have 3D vectors added or subtracted") {
+    View::XYVectorCloud cloud;
+    const View::Vector v;
+    const View::VectorCloud vs;
+
+    using added_type_1 = decltype(cloud += v);
+    using added_type_2 = decltype(cloud += vs);
+    using subtracted_type_1 = decltype(cloud -= v);
+    using subtracted_type_2 = decltype(cloud -= vs);
+    CHECK(static_cast<bool>(std::is_same_v<added_type_1, StaticAssert::invalid_vector_to_vector_addition>));
+    CHECK(static_cast<bool>(std::is_same_v<added_type_2, StaticAssert::invalid_vector_to_vector_addition>));
+    CHECK(static_cast<bool>(std::is_same_v<subtracted_type_1, StaticAssert::invalid_vector_from_vector_subtraction>));
+    CHECK(static_cast<bool>(std::is_same_v<subtracted_type_2, StaticAssert::invalid_vector_from_vector_subtraction>));
+}
+
+TEST_CASE("PointClouds cannot be converted to the same space") {
+    const TransformManager tm;
+    const View::PointCloud cloud;
+    using converted_type = decltype(cloud.ConvertTo<View>(tm));
+    using required_type = StaticAssert::invalid_same_space_conversion;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type, required_type>));
+}
+#endif
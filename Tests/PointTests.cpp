@@ -619,10 +619,36 @@ TEST_CASE("Points can format the default-formatting") {
 
 TEST_CASE("Points can localise the default-formatting") {
     const View::Point v(3.123, 4.123, 5.123);
-    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{}", v);
+    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{:L}", v);
     CHECK(localised.contains("(3,123, 4,123, 5,123"));
 }
 
+TEST_CASE("Points only localise the default-formatting when asked") {
+    const View::Point v(3.123, 4.123, 5.123);
+    CHECK(std::format(std::locale("de_DE.UTF-8"), "{}", v) == "View::Point (3.123, 4.123, 5.123)");
+}
+
+TEST_CASE("Points can align the default-formatting") {
+    const View::Point p(1, 0, 0);
+    CHECK(std::format("{:25}", p) == "View::Point (1, 0, 0)    ");
+    CHECK(std::format("{:>25}", p) == "    View::Point (1, 0, 0)");
+    CHECK(std::format("{:-^24}", p) == "-View::Point (1, 0, 0)--");
+    CHECK(std::format("{:10}", p) == "View::Point (1, 0, 0)");
+    CHECK(std::format(std::locale("de_DE.UTF-8"), "{:*>25L}", View::Point(0.5, 0, 0)) == "**View::Point (0,5, 0, 0)");
+}
+
+TEST_CASE("Points can be default-formatted next to alignment characters") {
+    const View::Point p(1, 0, 0);
+    CHECK(std::format("<{}>", p) == "<View::Point (1, 0, 0)>");
+    CHECK(std::format("{}^", p) == "View::Point (1, 0, 0)^");
+    CHECK(std::format("{:}<", p) == "View::Point (1, 0, 0)<");
+}
+
+TEST_CASE("Points cannot be formatted with a brace as the fill") {
+    const View::Point p(1, 0, 0);
+    CHECK_THROWS_AS(std::vformat("{:{<25}", std::make_format_args(p)), std::format_error);
+}
+
 TEST_CASE("Points can be formatted to show the space") {
     const View::Point p(1, 0, 0);
     CHECK(std::format("{:s}", p) == "View");
@@ -0,0 +1,129 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+struct FloatVector final {
+    std::array<float, 3> values{};
+};
+
+struct FloatView final : SpaceBase<FloatView, FloatVector, XY::IsUsed, Pixels, float> {
+    using PrecisionVariant = View;
+};
+struct UnrelatedFloatView final : SpaceBase<UnrelatedFloatView, FloatVector, XY::IsUsed, Pixels, float> {};
+struct FloatImage final : SpaceBase<FloatImage, FloatVector, XY::IsUsed, Millimetres, float> {};
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Spaces store doubles by default") {
+    CHECK(static_cast<bool>(std::is_same_v<View::Point::Scalar, double>));
+    CHECK(static_cast<bool>(std::is_same_v<decltype(View::Point().X()), double>));
+}
+
+TEST_CASE("Spaces can choose float as their scalar type") {
+    const FloatView::Point p(1.5f, 2.5f, 3.5f);
+    CHECK(static_cast<bool>(std::is_same_v<FloatView::Point::Scalar, float>));
+    CHECK(static_cast<bool>(std::is_same_v<decltype(p.X()), float>));
+    CHECK(sizeof(FloatView::Point) == 3 * sizeof(float));
+    CHECK(p.X() == 1.5f);
+    CHECK(p.Y() == 2.5f);
+    CHECK(p.Z() == 3.5f);
+}
+
+TEST_CASE("Float points and vectors support the same arithmetic") {
+    FloatView::Point p(1, 2, 3);
+    const FloatView::Vector v(1, 0, 0);
+    p += v;
+    CHECK(p == FloatView::Point(2, 2, 3));
+    CHECK(p - FloatView::Point(1, 1, 1) == FloatView::Vector(1, 1, 2));
+    CHECK((v * 2) == FloatView::Vector(2, 0, 0));
+    CHECK(v.Dot(FloatView::Vector(3, 4, 5)) == 3);
+    CHECK(v.Cross(FloatView::Vector(0, 1, 0)) == FloatView::Vector(0, 0, 1));
+    CHECK(FloatView::Vector(3, 4, 0).Mag_double() == 5);
+    CHECK(FloatView::Vector(0, 0, 2).Norm() == FloatView::NormalizedVector(0, 0, 1));
+    CHECK(FloatView::XYPoint(1, 2) + FloatView::XYVector(1, 1) == FloatView::XYPoint(2, 3));
+}
+
+TEST_CASE("Float points format without widening to double") {
+    const FloatView::Point p(0.1f, 2, 3);
+    CHECK(std::format("{:x}", p) == "0.1");
+}
+
+TEST_CASE("Float points can be converted to other float spaces") {
+    const AffineTransform<FloatView, FloatImage> t({{{1, 0, 0, 1}, {0, 1, 0, 2}, {0, 0, 1, 3}}});
+    CHECK(FloatView::Point(1, 2, 3).ConvertTo<FloatImage>(t) == FloatImage::Point(2, 4, 6));
+    CHECK(FloatView::Vector(1, 2, 3).ConvertTo<FloatImage>(t) == FloatImage::Vector(1, 2, 3));
+
+    std::vector<FloatView::Point> points(5, FloatView::Point(1, 1, 1));
+    std::vector<FloatImage::Point> converted(5);
+    t.Apply(FloatView::ConstPointSpan(points), FloatImage::PointSpan(converted));
+    CHECK(converted[4] == FloatImage::Point(2, 3, 4));
+}
+
+TEST_CASE("Float spans can be made from raw floats and used for arithmetic") {
+    std::vector<float> floats{1, 2, 3, 4, 5, 6};
+    const FloatView::VectorSpan span(floats);
+    CHECK(span.size() == 2);
+    CHECK(span.Scalars().data() == floats.data());
+
+    std::vector<FloatView::Vector> sums(2);
+    Add(FloatView::ConstVectorSpan(span), FloatView::ConstVectorSpan(span), FloatView::VectorSpan(sums));
+    CHECK(sums[1] == FloatView::Vector(8, 10, 12));
+
+    std::vector<float> dots(2);
+    Dot(FloatView::ConstVectorSpan(span), FloatView::ConstVectorSpan(span), dots);
+    CHECK(dots[0] == 14);
+}
+
+TEST_CASE("Float clouds store float columns") {
+    FloatView::PointCloud cloud{{1, 2, 3}};
+    CHECK(static_cast<bool>(std::is_same_v<decltype(cloud.Xs()), std::span<float>>));
+    cloud += FloatView::Vector(1, 1, 1);
+    CHECK(cloud[0] == FloatView::Point(2, 3, 4));
+}
+
+TEST_CASE("Points can be explicitly converted between precisions") {
+    const View::Point p(1.25, 2.5, 3.75);
+    const FloatView::Point f = PrecisionCast<FloatView>(p);
+    CHECK(f == FloatView::Point(1.25f, 2.5f, 3.75f));
+    CHECK(PrecisionCast<View>(f) == p);
+
+    CHECK(PrecisionCast<FloatView>(View::XYVector(1, 2)) == FloatView::XYVector(1, 2));
+    CHECK(PrecisionCast<FloatView>(View::NormalizedVector(0, 0, 1)) == FloatView::NormalizedVector(0, 0, 1));
+}
+
+TEST_CASE("Precision can only be changed between matching spaces") {
+    CHECK(implementation::PrecisionVariantOf<View, FloatView>);
+    CHECK(implementation::PrecisionVariantOf<FloatView, View>);
+    CHECK(!implementation::PrecisionVariantOf<View, FloatImage>);
+    CHECK(!implementation::PrecisionVariantOf<View, Image>);
+    CHECK(!implementation::PrecisionVariantOf<Volume, Data>);
+    CHECK(!implementation::PrecisionVariantOf<View, UnrelatedFloatView>);
+    CHECK(!implementation::PrecisionVariantOf<UnrelatedFloatView, View>);
+    CHECK(!implementation::PrecisionVariantOf<UnrelatedFloatView, FloatView>);
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("Changing precision between different spaces is a compile-time error") {
+    using converted_type = decltype(PrecisionCast<FloatImage>(View::Point()));
+    using required_type = StaticAssert::invalid_precision_conversion;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type, required_type>));
+}
+
+TEST_CASE("Changing precision into an unrelated space with the same units is a compile-time error") {
+    using required_type = StaticAssert::invalid_precision_conversion;
+    using from_double_type = decltype(PrecisionCast<UnrelatedFloatView>(View::Point()));
+    CHECK(static_cast<bool>(std::is_same_v<from_double_type, required_type>));
+    using to_double_type = decltype(PrecisionCast<View>(UnrelatedFloatView::Point()));
+    CHECK(static_cast<bool>(std::is_same_v<to_double_type, required_type>));
+}
+
+TEST_CASE("Float points cannot interact with vectors from other float spaces") {
+    FloatView::Point p;
+    using converted_type = decltype(p += FloatImage::Vector());
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type, required_type>));
+}
+#endif
@@ -34,22 +34,22 @@ namespace Space {
 enum class SpaceIDs { Volume = 0, Data, Image, View };
 
 struct Volume final : SpaceBase<Volume, TestVector, XY::IsNotUsed, Voxels> {
-    static inline SpaceIDs id = SpaceIDs::Volume;
+    static constexpr SpaceIDs id = SpaceIDs::Volume;
 };
 template <> constexpr std::string SpaceTypeNameMap<Volume>::name = "Volume";
 
 struct Data final : SpaceBase<Data, TestVector, XY::IsNotUsed, double> {
-    static inline SpaceIDs id = SpaceIDs::Data;
+    static constexpr SpaceIDs id = SpaceIDs::Data;
 };
 template <> constexpr std::string SpaceTypeNameMap<Data>::name = "Data";
 
 struct Image final : SpaceBase<Image, TestVector, XY::IsUsed, Millimetres> {
-    static inline SpaceIDs id = SpaceIDs::Image;
+    static constexpr SpaceIDs id = SpaceIDs::Image;
 };
 template <> constexpr std::string SpaceTypeNameMap<Image>::name = "Image";
 
 struct View final : SpaceBase<View, TestVector, XY::IsUsed, Pixels> {
-    static inline SpaceIDs id = SpaceIDs::View;
+    static constexpr SpaceIDs id = SpaceIDs::View;
 };
 template <> constexpr std::string SpaceTypeNameMap<View>::name = "View";
 
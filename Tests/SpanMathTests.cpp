@@ -0,0 +1,160 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+// More elements than any SIMD width, so that both the packed loop and the remainder are used.
+std::vector<View::Vector> MakeVectors(const double offset) {
+    std::vector<View::Vector> vectors;
+    for (int i = 0; i < 19; ++i) {
+        vectors.emplace_back(i + offset, 2 * i - offset, 3 - i * offset);
+    }
+    return vectors;
+}
+
+struct PaddedVector final {
+    double x = 0;
+    double y = 0;
+    double z = 0;
+    double tag = 7;
+};
+
+template <typename Lhs, typename Rhs, typename Out>
+concept SpansCanBeAdded = requires(const Lhs& lhs, const Rhs& rhs, const Out& out) { Add(lhs, rhs, out); };
+
+struct PaddedView final : SpaceBase<PaddedView, PaddedVector, XY::IsUsed, Pixels> {};
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Spans of vectors can be added") {
+    const auto a = MakeVectors(1);
+    const auto b = MakeVectors(2);
+    std::vector<View::Vector> sum(a.size());
+    Add(View::ConstVectorSpan(a), View::ConstVectorSpan(b), View::VectorSpan(sum));
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        CHECK(sum[i] == a[i] + b[i]);
+    }
+}
+
+TEST_CASE("Spans of vectors can be added to spans of points") {
+    const std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}};
+    const std::vector<View::Vector> vectors{{1, 1, 1}, {2, 2, 2}};
+    std::vector<View::Point> moved(points.size());
+    Add(View::ConstPointSpan(points), View::ConstVectorSpan(vectors), View::PointSpan(moved));
+    CHECK(moved[0] == View::Point(2, 3, 4));
+    CHECK(moved[1] == View::Point(6, 7, 8));
+}
+
+TEST_CASE("Spans of vectors can be subtracted in place") {
+    auto a = MakeVectors(1);
+    const auto b = MakeVectors(2);
+    const auto expected = a;
+    const View::VectorSpan span(a);
+    Sub(span, View::ConstVectorSpan(b), span);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        CHECK(a[i] == expected[i] - b[i]);
+    }
+}
+
+TEST_CASE("Spans of points can be subtracted to give spans of vectors") {
+    const std::vector<View::Point> a{{1, 2, 3}};
+    const std::vector<View::Point> b{{3, 3, 3}};
+    std::vector<View::Vector> difference(1);
+    Sub(View::ConstPointSpan(a), View::ConstPointSpan(b), View::VectorSpan(difference));
+    CHECK(difference[0] == View::Vector(-2, -1, 0));
+}
+
+TEST_CASE("Spans of vectors can be scaled") {
+    const auto a = MakeVectors(1);
+    std::vector<View::Vector> scaled(a.size());
+    Scale(View::ConstVectorSpan(a), 2.5, View::VectorSpan(scaled));
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        CHECK(scaled[i] == a[i] * 2.5);
+    }
+}
+
+TEST_CASE("Spans of vectors can be dotted") {
+    const auto a = MakeVectors(1);
+    const auto b = MakeVectors(2);
+    std::vector<double> dots(a.size());
+    Dot(View::ConstVectorSpan(a), View::ConstVectorSpan(b), dots);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        CHECK(dots[i] == Approx(a[i].Dot(b[i])));
+    }
+}
+
+TEST_CASE("Spans of vectors can be crossed") {
+    const auto a = MakeVectors(1);
+    const auto b = MakeVectors(2);
+    std::vector<View::Vector> crossed(a.size());
+    Cross(View::ConstVectorSpan(a), View::ConstVectorSpan(b), View::VectorSpan(crossed));
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        CHECK(crossed[i] == a[i].Cross(b[i]));
+    }
+}
+
+TEST_CASE("Spans of vectors give their magnitudes") {
+    const auto a = MakeVectors(1);
+    std::vector<double> mags(a.size());
+    Mag(View::ConstVectorSpan(a), mags);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        CHECK(mags[i] == Approx(a[i].Mag_double()));
+    }
+}
+
+TEST_CASE("Span arithmetic leaves the rest of padded elements alone") {
+    std::vector<PaddedVector> a(5, PaddedVector{1, 2, 3, 7});
+    std::vector<PaddedVector> b(5, PaddedVector{1, 1, 1, 7});
+    std::vector<PaddedVector> out(5, PaddedVector{0, 0, 0, 9});
+    Add(PaddedView::ConstVectorSpan(a), PaddedView::ConstVectorSpan(b), PaddedView::VectorSpan(out));
+    Cross(PaddedView::ConstVectorSpan(a), PaddedView::ConstVectorSpan(b), PaddedView::VectorSpan(a));
+    CHECK(out[4].x == 2);
+    CHECK(out[4].z == 4);
+    CHECK(out[4].tag == 9);
+    CHECK(a[4].x == -1);
+    CHECK(a[4].tag == 7);
+}
+
+TEST_CASE("Span arithmetic throws if spans have different sizes") {
+    const auto a = MakeVectors(1);
+    std::vector<View::Vector> sum(1);
+    CHECK_THROWS_WITH(Add(View::ConstVectorSpan(a), View::ConstVectorSpan(a), View::VectorSpan(sum)), "Spans must be the same size");
+}
+
+TEST_CASE("Span arithmetic follows the rules for single points and vectors") {
+    CHECK(SpansCanBeAdded<View::ConstVectorSpan, View::ConstVectorSpan, View::VectorSpan>);
+    CHECK_FALSE(SpansCanBeAdded<View::ConstPointSpan, View::ConstPointSpan, View::PointSpan>);
+    CHECK_FALSE(SpansCanBeAdded<View::ConstVectorSpan, View::ConstVectorSpan, View::PointSpan>);
+#ifdef IGNORE_SPACE_STATIC_ASSERT
+    CHECK_FALSE(SpansCanBeAdded<View::ConstVectorSpan, Image::ConstVectorSpan, View::VectorSpan>);
+#endif
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("Span arithmetic cannot mix spaces") {
+    const std::vector<View::Vector> view(1);
+    const std::vector<Image::Vector> image(1);
+    std::vector<View::Vector> viewOut(1);
+    std::vector<Image::Vector> imageOut(1);
+    std::vector<double> scalars(1);
+
+    using converted_type_1 = decltype(Add(View::ConstVectorSpan(view), Image::ConstVectorSpan(image), View::VectorSpan(viewOut)));
+    using converted_type_2 = decltype(Add(View::ConstVectorSpan(view), View::ConstVectorSpan(view), Image::VectorSpan(imageOut)));
+    using converted_type_3 = decltype(Sub(View::ConstVectorSpan(view), Image::ConstVectorSpan(image), View::VectorSpan(viewOut)));
+    using converted_type_4 = decltype(Scale(View::ConstVectorSpan(view), 2, Image::VectorSpan(imageOut)));
+    using converted_type_5 = decltype(Dot(View::ConstVectorSpan(view), Image::ConstVectorSpan(image), scalars));
+    using converted_type_6 =
+        decltype(Cross(View::ConstVectorSpan(view), Image::ConstVectorSpan(image), View::VectorSpan(viewOut)));
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_1, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_2, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_3, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_4, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_5, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<converted_type_6, required_type>));
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,153 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+void ScaleImpl(std::span<TestVector> impls) {
+    for (auto& impl : impls) {
+        std::ranges::transform(impl.m_values, impl.m_values.begin(), [](const double d) { return d * 2; });
+    }
+}
+
+std::vector<TestVector> MakeImpls() {
+    std::vector<TestVector> impls(2);
+    impls[0].m_values = {1, 2, 3};
+    impls[1].m_values = {4, 5, 6};
+    return impls;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Spans are empty by default") {
+    const View::PointSpan span;
+    CHECK(span.empty());
+    CHECK(span.size() == 0);
+}
+
+TEST_CASE("Spans can be created from typed collections") {
+    std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}};
+    const View::PointSpan span(points);
+    CHECK(span.size() == 2);
+    CHECK(span[1] == View::Point(4, 5, 6));
+}
+
+TEST_CASE("Const spans can be created from const typed collections") {
+    const std::vector<View::Vector> vectors{{1, 2, 3}, {4, 5, 6}};
+    const View::ConstVectorSpan span(vectors);
+    CHECK(span.size() == 2);
+    CHECK(span[0] == View::Vector(1, 2, 3));
+}
+
+TEST_CASE("Const spans can be created from spans") {
+    std::vector<View::Point> points{{1, 2, 3}};
+    const View::PointSpan span(points);
+    const View::ConstPointSpan const_span = span;
+    CHECK(const_span.data() == span.data());
+}
+
+TEST_CASE("Spans can be created over underlying data without copying") {
+    auto impls = MakeImpls();
+    const View::PointSpan span(impls);
+    CHECK(static_cast<const void*>(span.data()) == static_cast<const void*>(impls.data()));
+    CHECK(span[0] == View::Point(1, 2, 3));
+    CHECK(span[1] == View::Point(4, 5, 6));
+}
+
+TEST_CASE("Spans over underlying data can modify it") {
+    auto impls = MakeImpls();
+    const View::PointSpan span(impls);
+    span[0] += View::Vector(1, 1, 1);
+    CHECK(impls[0].m_values == std::array<double, 3>{2, 3, 4});
+}
+
+TEST_CASE("Spans can be created over raw doubles without copying") {
+    std::vector<double> doubles{1, 2, 3, 4, 5, 6};
+    const Data::VectorSpan span(doubles);
+    CHECK(span.size() == 2);
+    CHECK(span[1] == Data::Vector(4, 5, 6));
+    span[1].SetZ(7);
+    CHECK(doubles[5] == 7);
+}
+
+TEST_CASE("Spans throw if raw doubles are not a multiple of three") {
+    std::vector<double> doubles{1, 2, 3, 4};
+    CHECK_THROWS_WITH(Data::VectorSpan(doubles), "The number of doubles must be a multiple of three");
+}
+
+TEST_CASE("Spans can be handed back to non-templated functions as underlying data") {
+    std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}};
+    const View::PointSpan span(points);
+
+    ScaleImpl(span.Underlying());
+
+    CHECK(points[0] == View::Point(2, 4, 6));
+    CHECK(points[1] == View::Point(8, 10, 12));
+}
+
+TEST_CASE("Spans can be handed back as raw doubles") {
+    const std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}};
+    const View::ConstPointSpan span(points);
+    CHECK(std::ranges::equal(span.Doubles(), std::vector<double>{1, 2, 3, 4, 5, 6}));
+}
+
+TEST_CASE("Spans can be iterated") {
+    std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}};
+    for (auto& p : View::PointSpan(points)) {
+        p += View::Vector(1, 0, 0);
+    }
+    CHECK(points[0] == View::Point(2, 2, 3));
+    CHECK(points[1] == View::Point(5, 5, 6));
+}
+
+TEST_CASE("Spans work with range algorithms") {
+    const std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}};
+    const View::ConstPointSpan span(points);
+    const auto it = std::ranges::find(span, View::Point(4, 5, 6));
+    CHECK(it == span.begin() + 1);
+}
+
+TEST_CASE("Spans can be sliced") {
+    std::vector<View::Point> points{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+    const View::PointSpan span(points);
+    CHECK(span.first(1).size() == 1);
+    CHECK(span.last(1)[0] == View::Point(7, 8, 9));
+    CHECK(span.subspan(1, 1)[0] == View::Point(4, 5, 6));
+}
+
+TEST_CASE("Spans of vectors can be normalized without throwing") {
+    const std::vector<View::Vector> vectors{{0, 3, 4}, {0, 0, 0}, {2, 0, 0}};
+    std::vector<View::NormalizedVector> normalized(vectors.size());
+    std::array<std::uint64_t, 1> failures{~std::uint64_t{0}};
+    const auto failed = NormalizeAll(View::ConstVectorSpan(vectors), View::NormalizedVectorSpan(normalized), failures);
+    CHECK(failed == 1);
+    CHECK(failures[0] == 0b010);
+    CHECK(normalized[0] == View::NormalizedVector(0, 3.0 / 5, 4.0 / 5));
+    CHECK(normalized[1] == View::NormalizedVector());
+    CHECK(normalized[2] == View::NormalizedVector(1, 0, 0));
+}
+
+TEST_CASE("Spans of vectors report failures beyond the first word") {
+    std::vector<View::Vector> vectors(130, View::Vector(1, 1, 0));
+    vectors[64] = View::Vector();
+    vectors[129] = View::Vector();
+    std::vector<View::NormalizedVector> normalized(vectors.size());
+    std::array<std::uint64_t, 3> failures{};
+    CHECK(NormalizeAll(View::ConstVectorSpan(vectors), View::NormalizedVectorSpan(normalized), failures) == 2);
+    CHECK(failures[0] == 0);
+    CHECK(failures[1] == 1);
+    CHECK(failures[2] == std::uint64_t{1} << 1);
+}
+
+TEST_CASE("Spans of vectors throw if there are too few failure bits") {
+    const std::vector<View::Vector> vectors(65);
+    std::vector<View::NormalizedVector> normalized(vectors.size());
+    std::array<std::uint64_t, 1> failures{};
+    CHECK_THROWS_WITH(
+        NormalizeAll(View::ConstVectorSpan(vectors), View::NormalizedVectorSpan(normalized), failures),
+        "There must be a failure bit for every vector"
+    );
+}
+
+//-------------------------------------------------------------------------------------------------
@@ -0,0 +1,131 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+#include <random>
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+namespace {
+
+template <typename Grid, typename Radius>
+concept SearchableWithRadius = requires(const Grid& grid, const Image::Point& query, const Radius& radius) {
+    grid.WithinRadius(query, radius);
+};
+} // namespace
+
+TEST_CASE("A spatial hash grid finds the points within a radius") {
+    Image::SpatialHashGrid grid(Millimetres(1));
+    const auto a = grid.Insert(Image::Point(0, 0, 0));
+    const auto b = grid.Insert(Image::Point(0.5, 0, 0));
+    const auto c = grid.Insert(Image::Point(3, 0, 0));
+    grid.Insert(Image::Point(-2.5, 0, 0));
+    CHECK(grid.size() == 4);
+
+    const auto found = grid.WithinRadius(Image::Point(0.4, 0, 0), Millimetres(0.5));
+    REQUIRE(found.size() == 2);
+    CHECK(found[0].index == b);
+    CHECK(found[0].distance == Approx(0.1));
+    CHECK(found[1].index == a);
+
+    CHECK(grid.WithinRadius(Image::Point(3, 1, 0), Millimetres(1)).front().index == c);
+    CHECK(grid.WithinRadius(Image::Point(0, 0, 0), Millimetres(10)).size() == 4);
+    CHECK(grid.WithinRadius(Image::Point(0, 0, 0), Millimetres(-1)).empty());
+}
+
+TEST_CASE("Points in a spatial hash grid can be moved and removed") {
+    Image::SpatialHashGrid grid(Millimetres(2));
+    const auto a = grid.Insert(Image::Point(1, 1, 1));
+    const auto b = grid.Insert(Image::Point(1.5, 1, 1));
+
+    grid.Move(a, Image::Point(1.2, 1, 1));
+    CHECK(grid.Position(a) == Image::Point(1.2, 1, 1));
+    grid.Move(a, Image::Point(-9, -9, -9));
+    CHECK(grid.WithinRadius(Image::Point(1, 1, 1), Millimetres(1)).size() == 1);
+    CHECK(grid.WithinRadius(Image::Point(-9, -9, -9), Millimetres(1)).front().index == a);
+
+    grid.Remove(b);
+    CHECK(grid.size() == 1);
+    CHECK(grid.WithinRadius(Image::Point(1, 1, 1), Millimetres(1)).empty());
+    CHECK_THROWS_AS(grid.Remove(b), std::invalid_argument);
+    CHECK_THROWS_AS(grid.Move(b, Image::Point(0, 0, 0)), std::invalid_argument);
+    CHECK_THROWS_AS(grid.Position(7), std::invalid_argument);
+
+    // Ids are given out again once their points have gone.
+    CHECK(grid.Insert(Image::Point(0, 0, 0)) == b);
+}
+
+TEST_CASE("A spatial hash grid rejects cells it cannot represent") {
+    CHECK_THROWS_AS(Volume::SpatialHashGrid(Voxels(0)), std::invalid_argument);
+    CHECK_THROWS_AS(Volume::SpatialHashGrid(Voxels(-1)), std::invalid_argument);
+
+    Volume::SpatialHashGrid grid(Voxels(1e-300));
+    CHECK_THROWS_AS(grid.Insert(Volume::Point(1e10, 0, 0)), std::invalid_argument);
+    CHECK_THROWS_AS(grid.Insert(Volume::Point(std::numeric_limits<double>::quiet_NaN(), 0, 0)), std::invalid_argument);
+    CHECK(grid.empty());
+}
+
+TEST_CASE("A spatial hash grid finds the same points as a search of every point") {
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(-50, 50);
+    Data::SpatialHashGrid grid(4.0);
+    std::vector<Data::Point> points;
+    for (int i = 0; i < 2000; ++i) {
+        points.emplace_back(distribution(generator), distribution(generator), distribution(generator));
+        grid.Insert(points.back());
+    }
+    for (std::size_t i = 0; i < points.size(); i += 3) {
+        points[i] = Data::Point(distribution(generator), distribution(generator), distribution(generator));
+        grid.Move(i, points[i]);
+    }
+
+    for (const double radius : {0.0, 3.0, 10.0, 500.0}) {
+        const Data::Point query(1, -2, 3);
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            if ((points[i] - query).Mag_double() <= radius) {
+                expected.push_back(i);
+            }
+        }
+        std::vector<std::size_t> found;
+        for (const auto& neighbour : grid.WithinRadius(query, radius)) {
+            found.push_back(neighbour.index);
+        }
+        std::sort(found.begin(), found.end());
+        CHECK(found == expected);
+    }
+}
+
+TEST_CASE("A spatial hash grid only takes lengths in the units of its space") {
+    static_assert(std::is_constructible_v<Image::SpatialHashGrid, Millimetres>);
+    static_assert(!std::is_constructible_v<Image::SpatialHashGrid, Pixels>);
+    static_assert(!std::is_constructible_v<Image::SpatialHashGrid, double>);
+    static_assert(SearchableWithRadius<Image::SpatialHashGrid, Millimetres>);
+    static_assert(!SearchableWithRadius<Image::SpatialHashGrid, Pixels>);
+    static_assert(!SearchableWithRadius<Image::SpatialHashGrid, double>);
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("A spatial hash grid only holds points from its own space") {
+    Image::SpatialHashGrid grid(Millimetres(1));
+    using insert_type = decltype(grid.Insert(View::Point()));
+    using move_type = decltype(grid.Move(0, View::Point()));
+    using search_type = decltype(grid.WithinRadius(View::Point(), Millimetres(1)));
+    using required_type = StaticAssert::invalid_space;
+    CHECK(static_cast<bool>(std::is_same_v<insert_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<move_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<search_type, required_type>));
+}
+
+TEST_CASE("A spatial hash grid only holds points") {
+    Image::SpatialHashGrid grid(Millimetres(1));
+    using insert_type = decltype(grid.Insert(Image::Vector()));
+    using move_type = decltype(grid.Move(0, Image::XYPoint()));
+    using search_type = decltype(grid.WithinRadius(Image::NormalizedVector(), Millimetres(1)));
+    using required_type = StaticAssert::invalid_spatial_query;
+    CHECK(static_cast<bool>(std::is_same_v<insert_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<move_type, required_type>));
+    CHECK(static_cast<bool>(std::is_same_v<search_type, required_type>));
+}
+#endif
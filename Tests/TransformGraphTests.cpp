@@ -0,0 +1,112 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+using Chain = TransformGraph<Edge<Volume, Data>, Edge<Data, Image>, Edge<Image, View>>;
+
+AffineTransform<Volume, Data> VolumeToData() {
+    return AffineTransform<Volume, Data>({{{2, 0, 0, 1}, {0, 2, 0, 1}, {0, 0, 2, 1}}});
+}
+
+AffineTransform<Data, Image> DataToImage() {
+    return AffineTransform<Data, Image>({{{0, -1, 0, 10}, {1, 0, 0, 20}, {0, 0, 1, 30}}});
+}
+
+AffineTransform<Image, View> ImageToView() {
+    return AffineTransform<Image, View>({{{1, 0, 0, -5}, {0, 1, 0, -5}, {0, 0, 3, 0}}});
+}
+
+Chain MakeChain() { return Chain(VolumeToData(), DataToImage(), ImageToView()); }
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("TransformGraphs find the shortest route") {
+    CHECK(Chain::Hops<Volume, Data>() == 1);
+    CHECK(Chain::Hops<Volume, View>() == 3);
+    CHECK(Chain::Hops<Data, View>() == 2);
+
+    using Shortcut = TransformGraph<Edge<Volume, Data>, Edge<Data, Image>, Edge<Image, View>, Edge<Volume, Image>>;
+    CHECK(Shortcut::Hops<Volume, View>() == 2);
+}
+
+TEST_CASE("TransformGraphs are the identity by default") {
+    const Chain graph;
+    CHECK(Volume::Point(1, 2, 3).ConvertTo<View>(graph) == View::Point(1, 2, 3));
+}
+
+TEST_CASE("TransformGraphs convert points along several edges") {
+    const auto graph = MakeChain();
+    const Volume::Point p(1, 2, 3);
+    const auto expected = ImageToView().Apply(DataToImage().Apply(VolumeToData().Apply(p)));
+    CHECK(p.ConvertTo<View>(graph) == expected);
+    CHECK(p.ConvertTo<View>(graph) == View::Point(0, 18, 111));
+}
+
+TEST_CASE("TransformGraphs convert vectors along several edges") {
+    const auto graph = MakeChain();
+    const Volume::Vector v(1, 2, 3);
+    CHECK(v.ConvertTo<Image>(graph) == Image::Vector(-4, 2, 6));
+}
+
+TEST_CASE("TransformGraphs return the composed transform") {
+    const auto graph = MakeChain();
+    const AffineTransform<Volume, View> t = graph.Get<Volume, View>();
+    const auto expected = VolumeToData() * DataToImage() * ImageToView();
+    for (int row = 0; row < 3; ++row) {
+        for (int column = 0; column < 4; ++column) {
+            CHECK(t(row, column) == expected(row, column));
+        }
+    }
+}
+
+TEST_CASE("TransformGraphs update the cached routes when an edge is set") {
+    auto graph = MakeChain();
+    graph.Set(AffineTransform<Data, Image>());
+    const Volume::Point p(1, 2, 3);
+    CHECK(p.ConvertTo<View>(graph) == View::Point(-2, 0, 21));
+    CHECK(p.ConvertTo<Data>(graph) == Data::Point(3, 5, 7));
+}
+
+TEST_CASE("TransformGraphs convert spans in one pass") {
+    const auto graph = MakeChain();
+    std::vector<Volume::Point> points;
+    for (int i = 0; i < 7; ++i) {
+        points.emplace_back(i, 2 * i, 3 * i);
+    }
+    const auto converted = Volume::ConstPointSpan(points).ConvertTo<View>(graph);
+    REQUIRE(converted.size() == points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        CHECK(converted[i] == points[i].ConvertTo<View>(graph));
+    }
+}
+
+TEST_CASE("TransformGraphs convert point clouds") {
+    const auto graph = MakeChain();
+    Volume::PointCloud cloud;
+    cloud.push_back(Volume::Point(1, 2, 3));
+    cloud.push_back(Volume::Point(4, 5, 6));
+    const auto converted = cloud.ConvertTo<View>(graph);
+    CHECK(converted[0] == View::Point(0, 18, 111));
+    CHECK(converted[1] == Volume::Point(4, 5, 6).ConvertTo<View>(graph));
+}
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+TEST_CASE("TransformGraphs cannot convert against the direction of the edges") {
+    const auto graph = MakeChain();
+    using converted_type = decltype(graph.Get<View, Volume>());
+    using required_type = StaticAssert::no_transform_route;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type, required_type>));
+}
+
+TEST_CASE("TransformGraphs can only set their own edges") {
+    auto graph = MakeChain();
+    using converted_type = decltype(graph.Set(AffineTransform<Volume, View>()));
+    using required_type = StaticAssert::invalid_transform_edge;
+    CHECK(static_cast<bool>(std::is_same_v<converted_type, required_type>));
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------
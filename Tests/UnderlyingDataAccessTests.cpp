@@ -0,0 +1,87 @@
+#include "Includes.h"
+#include "SpaceHelpers.h"
+
+using namespace Space;
+
+//-------------------------------------------------------------------------------------------------
+
+/// A four-component type, like a padded SIMD register, whose components do not
+/// start at the beginning of the object.
+struct alignas(32) OffsetVector final {
+    double w{};
+    std::array<double, 3> xyz{};
+};
+
+template <> struct Space::UnderlyingDataAccess<OffsetVector> {
+    static constexpr std::size_t stride = 4;
+
+    [[nodiscard]] static double* Data(OffsetVector& u) noexcept { return u.xyz.data(); }
+    [[nodiscard]] static const double* Data(const OffsetVector& u) noexcept { return u.xyz.data(); }
+
+    [[nodiscard]] static constexpr double Get(const OffsetVector& u, const std::size_t i) noexcept { return u.xyz[i]; }
+    static constexpr void Set(OffsetVector& u, const std::size_t i, const double value) noexcept { u.xyz[i] = value; }
+};
+
+struct OffsetView final : SpaceBase<OffsetView, OffsetVector, XY::IsUsed, Pixels> {};
+struct OffsetImage final : SpaceBase<OffsetImage, OffsetVector, XY::IsUsed, Millimetres> {};
+
+//-------------------------------------------------------------------------------------------------
+
+TEST_CASE("Points use the customized layout of the underlying data") {
+    OffsetView::Point p(1, 2, 3);
+    CHECK(sizeof(OffsetView::Point) == 32);
+    CHECK(static_cast<OffsetVector>(p).w == 0);
+    CHECK(static_cast<OffsetVector>(p).xyz[2] == 3);
+
+    p.SetY(5);
+    p[2] = 6;
+    CHECK(p == OffsetView::Point(1, 5, 6));
+    CHECK(*p.cbegin() == 1);
+    CHECK(std::vector<double>(p.cbegin(), p.cend()) == std::vector<double>{1, 5, 6});
+}
+
+TEST_CASE("Customized layouts support the same arithmetic") {
+    const OffsetView::Point p(1, 2, 3);
+    const OffsetView::Vector v(1, 0, 0);
+    CHECK(p + v == OffsetView::Point(2, 2, 3));
+    CHECK(p - OffsetView::Point(1, 1, 1) == OffsetView::Vector(0, 1, 2));
+    CHECK(v.Cross(OffsetView::Vector(0, 1, 0)) == OffsetView::Vector(0, 0, 1));
+    CHECK(OffsetView::Vector(0, 3, 4).Mag_double() == 5);
+    CHECK(OffsetView::Vector(0, 0, 2).Norm() == OffsetView::NormalizedVector(0, 0, 1));
+    CHECK(p.ToXY() == OffsetView::XYPoint(1, 2));
+}
+
+TEST_CASE("Customized layouts can be used in constant expressions") {
+    static_assert(OffsetView::Point(1, 2, 3) + OffsetView::Vector(1, 1, 1) == OffsetView::Point(2, 3, 4));
+    static_assert(OffsetView::NormalizedVector(0, 4, 0).Y() == 1);
+    CHECK(OffsetView::Point(1, 2, 3).Z() == 3);
+}
+
+TEST_CASE("Span maths follows the customized stride") {
+    std::vector<OffsetView::Vector> a{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+    std::vector<OffsetView::Vector> sums(3);
+    Add(OffsetView::ConstVectorSpan(a), OffsetView::ConstVectorSpan(a), OffsetView::VectorSpan(sums));
+    CHECK(sums[2] == OffsetView::Vector(14, 16, 18));
+
+    std::vector<double> dots(3);
+    Dot(OffsetView::ConstVectorSpan(a), OffsetView::ConstVectorSpan(a), dots);
+    CHECK(dots[1] == 77);
+
+    std::vector<OffsetView::NormalizedVector> normals(3);
+    std::vector<std::uint64_t> failures(1);
+    CHECK(NormalizeAll(OffsetView::ConstVectorSpan(a), OffsetView::NormalizedVectorSpan(normals), failures) == 0);
+    CHECK(normals[0] == OffsetView::Vector(1, 2, 3).Norm());
+}
+
+TEST_CASE("Customized layouts can be transformed between spaces") {
+    const AffineTransform<OffsetView, OffsetImage> t({{{1, 0, 0, 1}, {0, 1, 0, 2}, {0, 0, 1, 3}}});
+    CHECK(OffsetView::Point(1, 2, 3).ConvertTo<OffsetImage>(t) == OffsetImage::Point(2, 4, 6));
+
+    std::vector<OffsetView::Point> points(5, OffsetView::Point(1, 1, 1));
+    std::vector<OffsetImage::Point> converted(5);
+    t.Apply(OffsetView::ConstPointSpan(points), OffsetImage::PointSpan(converted));
+    CHECK(converted[4] == OffsetImage::Point(2, 3, 4));
+
+    const OffsetView::XYPointCloud cloud{{1, 2}, {3, 4}};
+    CHECK(cloud.ConvertTo<OffsetImage>(t)[1] == OffsetImage::Point(4, 6, 3));
+}
@@ -814,6 +814,16 @@ TEST_CASE("Zero size vectors throw the correct message when you try and normalis
     const Image::Vector v(0, 0, 0);
     CHECK_THROWS_WITH(v.Norm(), "Zero-sized normal vectors are not allowed");
 }
+TEST_CASE("Vectors can be normalized without throwing") {
+    const Image::Vector v(0, 3, 4);
+    const std::optional<Image::NormalizedVector> v_norm = v.TryNorm();
+    REQUIRE(v_norm.has_value());
+    CHECK(*v_norm == Image::NormalizedVector(0, 3.0 / 5, 4.0 / 5));
+}
+TEST_CASE("Zero size vectors give an empty optional when you try and normalise them") {
+    const Image::Vector v(0, 0, 0);
+    CHECK_FALSE(v.TryNorm().has_value());
+}
 
 TEST_CASE("Vectors can be converted from one space to another ignoring translation") {
     TransformManager tm;
@@ -867,7 +877,7 @@ TEST_CASE("Vectors can format the default-formatting") {
 
 TEST_CASE("Vectors can localise the default-formatting") {
     const View::Vector v(3.123, 4.123, 5.123);
-    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{}", v);
+    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{:L}", v);
     CHECK(localised.contains("(3,123, 4,123, 5,123"));
 }
 
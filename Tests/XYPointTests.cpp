@@ -624,7 +624,7 @@ TEST_CASE("XYPoints can format the default-formatting") {
 
 TEST_CASE("XYPoints can localise the default-formatting") {
     const View::XYPoint v(3.123, 4.123);
-    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{}", v);
+    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{:L}", v);
     CHECK(localised.contains("(3,123, 4,123"));
 }
 
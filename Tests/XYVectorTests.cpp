@@ -807,6 +807,16 @@ TEST_CASE("Zero size XYVectors throw the correct message when you try and normal
     const Image::XYVector v(0, 0);
     CHECK_THROWS_WITH(v.Norm(), "Zero-sized normal vectors are not allowed");
 }
+TEST_CASE("XYVectors can be normalized without throwing") {
+    const Image::XYVector v(3, 4);
+    const std::optional<Image::NormalizedXYVector> v_norm = v.TryNorm();
+    REQUIRE(v_norm.has_value());
+    CHECK(*v_norm == Image::NormalizedXYVector(3.0 / 5, 4.0 / 5));
+}
+TEST_CASE("Zero size XYVectors give an empty optional when you try and normalise them") {
+    const Image::XYVector v(0, 0);
+    CHECK_FALSE(v.TryNorm().has_value());
+}
 
 TEST_CASE("XYVectors can be converted from one space to another ignoring translation") {
     TransformManager tm;
@@ -860,7 +870,7 @@ TEST_CASE("XYVectors can format the default-formatting") {
 
 TEST_CASE("XYVectors can localise the default-formatting") {
     const View::XYVector v(3.123, 4.123);
-    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{}", v);
+    const auto localised = std::format(std::locale("de_DE.UTF-8"), "{:L}", v);
     CHECK(localised.contains("(3,123, 4,123"));
 }
 
@@ -0,0 +1,199 @@
+#pragma once
+
+namespace Space {
+
+/// Declares a direct affine transform from one space to another in a TransformGraph.
+template <typename From, typename To> struct Edge final {};
+
+namespace implementation {
+
+template <typename... Ts> struct TypeList final {
+    static constexpr std::size_t size = sizeof...(Ts);
+};
+
+template <typename List, typename... Ts> struct UniqueTypes;
+
+template <typename... Us> struct UniqueTypes<TypeList<Us...>> {
+    using type = TypeList<Us...>;
+};
+
+template <typename... Us, typename T, typename... Ts> struct UniqueTypes<TypeList<Us...>, T, Ts...> {
+    using type = typename std::conditional_t<
+        (std::is_same_v<T, Us> || ...),
+        UniqueTypes<TypeList<Us...>, Ts...>,
+        UniqueTypes<TypeList<Us..., T>, Ts...>>::type;
+};
+
+template <typename T, typename... Ts> consteval std::size_t IndexOf(TypeList<Ts...>) {
+    constexpr std::array<bool, sizeof...(Ts)> matches{std::is_same_v<T, Ts>...};
+    for (std::size_t i = 0; i < matches.size(); ++i) {
+        if (matches[i]) {
+            return i;
+        }
+    }
+    return sizeof...(Ts);
+}
+
+/// The sequence of edges leading from one node to another.
+template <std::size_t N> struct Route final {
+    bool reachable = false;
+    std::size_t length = 0;
+    std::array<std::size_t, N> edges{};
+};
+
+/// Finds the route with the fewest edges between every pair of nodes.
+template <std::size_t N, std::size_t E>
+consteval auto ShortestRoutes(const std::array<std::pair<std::size_t, std::size_t>, E>& edges) {
+    std::array<std::array<Route<N>, N>, N> routes{};
+    for (std::size_t from = 0; from < N; ++from) {
+        auto& found = routes[from];
+        found[from].reachable = true;
+
+        std::array<std::size_t, N> queue{};
+        std::size_t head = 0;
+        std::size_t tail = 0;
+        queue[tail++] = from;
+        while (head < tail) {
+            const auto node = queue[head++];
+            for (std::size_t e = 0; e < E; ++e) {
+                const auto [source, destination] = edges[e];
+                if (source != node || found[destination].reachable) {
+                    continue;
+                }
+                found[destination] = found[node];
+                found[destination].edges[found[destination].length++] = e;
+                queue[tail++] = destination;
+            }
+        }
+    }
+    return routes;
+}
+
+} // namespace implementation
+
+/// A set of affine transforms between spaces, known at compile time. A
+/// conversion between any two connected spaces follows the route with the
+/// fewest transforms, and the composed matrix for every route is cached when
+/// a transform is set, so converting costs one matrix multiply per element
+/// however many transforms the route passes through.
+template <typename... Edges> class TransformGraph;
+
+template <typename... Froms, typename... Tos> class TransformGraph<Edge<Froms, Tos>...> final {
+    using _spaces = typename implementation::UniqueTypes<implementation::TypeList<>, Froms..., Tos...>::type;
+    using _edges = implementation::TypeList<Edge<Froms, Tos>...>;
+
+    static constexpr std::size_t spaceCount = _spaces::size;
+    static constexpr std::size_t edgeCount = sizeof...(Froms);
+
+    template <typename S> static constexpr std::size_t spaceIndex = implementation::IndexOf<S>(_spaces{});
+
+    static constexpr std::array<std::pair<std::size_t, std::size_t>, edgeCount> edges{
+        std::pair{spaceIndex<Froms>, spaceIndex<Tos>}...
+    };
+    static constexpr auto routes = implementation::ShortestRoutes<spaceCount>(edges);
+
+    template <typename From, typename To>
+    static constexpr std::size_t edgeIndex = implementation::IndexOf<Edge<From, To>>(_edges{});
+
+    template <typename From, typename To> static consteval bool HasEdge() { return edgeIndex<From, To> < edgeCount; }
+
+    template <typename From, typename To> static consteval bool Connected() {
+        constexpr auto from = spaceIndex<From>;
+        constexpr auto to = spaceIndex<To>;
+        if constexpr (from == spaceCount || to == spaceCount) {
+            return false;
+        } else {
+            return routes[from][to].reachable;
+        }
+    }
+
+  public:
+    /// Every transform starts as the identity.
+    TransformGraph() noexcept = default;
+
+    explicit TransformGraph(const AffineTransform<Froms, Tos>&... transforms) noexcept
+        : transforms{transforms.Matrix()...} {
+        Update();
+    }
+
+    /// Replaces the transform for one edge and recomputes every cached route.
+    template <typename From, typename To> requires(HasEdge<From, To>())
+    void Set(const AffineTransform<From, To>& transform) noexcept {
+        transforms[edgeIndex<From, To>] = transform.Matrix();
+        Update();
+    }
+
+    /// The number of transforms on the route between two spaces.
+    template <typename From, typename To> requires(Connected<From, To>())
+    [[nodiscard]] static constexpr std::size_t Hops() noexcept {
+        return routes[spaceIndex<From>][spaceIndex<To>].length;
+    }
+
+    template <typename From, typename To> requires(Connected<From, To>())
+    [[nodiscard]] AffineTransform<From, To> Get() const noexcept {
+        return AffineTransform<From, To>(Composed<From, To>());
+    }
+
+    template <typename From, typename To, typename UnderlyingData> requires(Connected<From, To>())
+    [[nodiscard]] UnderlyingData TransformPoint(const UnderlyingData& in) const noexcept {
+        UnderlyingData out = in;
+        Composed<From, To>().template Apply<true>(
+            implementation::CBegin<implementation::ScalarOf<From>>(in), implementation::Begin<implementation::ScalarOf<From>>(out)
+        );
+        return out;
+    }
+
+    template <typename From, typename To, typename UnderlyingData> requires(Connected<From, To>())
+    [[nodiscard]] UnderlyingData TransformVector(const UnderlyingData& in) const noexcept {
+        UnderlyingData out = in;
+        Composed<From, To>().template Apply<false>(
+            implementation::CBegin<implementation::ScalarOf<From>>(in), implementation::Begin<implementation::ScalarOf<From>>(out)
+        );
+        return out;
+    }
+
+    template <typename From, typename To, typename UnderlyingData> requires(Connected<From, To>())
+    void TransformPoints(std::span<const UnderlyingData> in, std::span<UnderlyingData> out) const {
+        Get<From, To>().template TransformPoints<From, To>(in, out);
+    }
+
+    template <typename From, typename To, typename UnderlyingData> requires(Connected<From, To>())
+    void TransformVectors(std::span<const UnderlyingData> in, std::span<UnderlyingData> out) const {
+        Get<From, To>().template TransformVectors<From, To>(in, out);
+    }
+
+#ifndef IGNORE_SPACE_STATIC_ASSERT
+    template <typename From, typename To> requires(!HasEdge<From, To>())
+    StaticAssert::invalid_transform_edge Set(const AffineTransform<From, To>&) noexcept {
+        return StaticAssert::invalid_transform_edge{};
+    }
+
+    template <typename From, typename To> requires(!Connected<From, To>())
+    StaticAssert::no_transform_route Get() const noexcept {
+        return StaticAssert::no_transform_route{};
+    }
+#endif
+
+  private:
+    template <typename From, typename To> [[nodiscard]] const implementation::AffineMatrix& Composed() const noexcept {
+        return composed[spaceIndex<From> * spaceCount + spaceIndex<To>];
+    }
+
+    void Update() noexcept {
+        for (std::size_t from = 0; from < spaceCount; ++from) {
+            for (std::size_t to = 0; to < spaceCount; ++to) {
+                const auto& route = routes[from][to];
+                implementation::AffineMatrix m;
+                for (std::size_t i = 0; i < route.length; ++i) {
+                    m = transforms[route.edges[i]] * m;
+                }
+                composed[from * spaceCount + to] = m;
+            }
+        }
+    }
+
+    std::array<implementation::AffineMatrix, edgeCount> transforms{};
+    std::array<implementation::AffineMatrix, spaceCount * spaceCount> composed{};
+};
+
+} // namespace Space
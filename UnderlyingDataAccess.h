@@ -0,0 +1,52 @@
+#pragma once
+
+namespace Space::implementation {
+
+template <typename Scalar, typename UnderlyingData>
+inline constexpr bool bitCastable = std::is_trivially_copyable_v<UnderlyingData> && sizeof(UnderlyingData) % sizeof(Scalar) == 0;
+
+template <typename Scalar, typename UnderlyingData>
+using ScalarArray = std::array<Scalar, sizeof(UnderlyingData) / sizeof(Scalar)>;
+} // namespace Space::implementation
+
+namespace Space {
+
+/// Describes where the x, y and z components of an underlying implementation
+/// are held. By default they are the first three fields. Any other layout, such
+/// as a padded four-component SIMD type, can be described by specializing this
+/// template for the underlying type:
+///
+/// - Get and Set read and write component i, and may be used in constant expressions.
+/// - Data points to x, with y and z immediately after it.
+/// - stride is the number of scalars from one element of an array to the next.
+template <typename UnderlyingData, typename Scalar = double> struct UnderlyingDataAccess {
+    static constexpr std::size_t stride = sizeof(UnderlyingData) / sizeof(Scalar);
+
+    [[nodiscard]] static Scalar* Data(UnderlyingData& u) noexcept { return reinterpret_cast<Scalar*>(&u); }
+    [[nodiscard]] static const Scalar* Data(const UnderlyingData& u) noexcept { return reinterpret_cast<const Scalar*>(&u); }
+
+    /// At run time the data is viewed in place as scalars. Constant evaluation
+    /// does not allow that, so there the data is copied to and from an array of
+    /// scalars with bit_cast.
+    [[nodiscard]] static constexpr Scalar Get(const UnderlyingData& u, const std::size_t i) noexcept {
+        if consteval {
+            if constexpr (implementation::bitCastable<Scalar, UnderlyingData>) {
+                return std::bit_cast<implementation::ScalarArray<Scalar, UnderlyingData>>(u)[i];
+            }
+        }
+        return Data(u)[i];
+    }
+
+    static constexpr void Set(UnderlyingData& u, const std::size_t i, const Scalar value) noexcept {
+        if consteval {
+            if constexpr (implementation::bitCastable<Scalar, UnderlyingData>) {
+                auto values = std::bit_cast<implementation::ScalarArray<Scalar, UnderlyingData>>(u);
+                values[i] = value;
+                u = std::bit_cast<UnderlyingData>(values);
+                return;
+            }
+        }
+        Data(u)[i] = value;
+    }
+};
+} // namespace Space
@@ -8,92 +8,95 @@ class Vector final : public Base<ThisSpace, UnderlyingData, BaseType::Vector> {
     using _base = Base<ThisSpace, UnderlyingData, BaseType::Vector>;
 
   public:
-    Vector() noexcept { std::fill(_base::begin(), _base::end(), 0); }
-    explicit Vector(const UnderlyingData& v) noexcept {
-        std::copy(implementation::CBegin(v), implementation::CEnd(v), _base::begin());
-    }
-    Vector(const double x, const double y, const double z) noexcept {
-        auto iter = _base::begin();
-        *iter++ = x;
-        *iter++ = y;
-        *iter = z;
+    using Scalar = typename _base::Scalar;
+
+    constexpr Vector() noexcept { _base::Assign(0, 0, 0); }
+    constexpr explicit Vector(const UnderlyingData& v) noexcept {
+        _base::Assign(ComponentOf<Scalar>(v, 0), ComponentOf<Scalar>(v, 1), ComponentOf<Scalar>(v, 2));
     }
+    constexpr Vector(const Scalar x, const Scalar y, const Scalar z) noexcept { _base::Assign(x, y, z); }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        return std::equal(_base::cbegin(), _base::cend(), implementation::CBegin(UnderlyingDataFrom(other)), Equality);
+    [[nodiscard]] constexpr bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        return _base::EqualTo(UnderlyingDataFrom(other));
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+    [[nodiscard]] constexpr bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
         return !(operator==(other));
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    auto operator-=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
-        Sub(_base::underlyingData, UnderlyingDataFrom(rhs));
+    constexpr auto& operator-=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
+        Sub<Scalar>(_base::underlyingData, UnderlyingDataFrom(rhs));
         return *this;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(_base::X(), _base::Y(), _base::Z());
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    auto operator+=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
-        Add(_base::underlyingData, UnderlyingDataFrom(rhs));
+    constexpr auto& operator+=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
+        Add<Scalar>(_base::underlyingData, UnderlyingDataFrom(rhs));
         return *this;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(_base::X(), _base::Y(), _base::Z());
-        Add(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Add<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
-    auto operator*=(const double& d) noexcept {
-        Scale(_base::underlyingData, d);
+    constexpr auto& operator*=(const double& d) noexcept {
+        Scale<Scalar>(_base::underlyingData, d);
         return *this;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    auto operator*=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
+    constexpr auto& operator*=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
         *this = this->Cross(rhs);
         return *this;
     }
 
-    [[nodiscard]] auto operator*(const double& d) const noexcept {
+    [[nodiscard]] constexpr auto operator*(const double& d) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(_base::X(), _base::Y(), _base::Z());
-        Scale(UnderlyingDataFrom(v), d);
+        Scale<Scalar>(UnderlyingDataFrom(v), d);
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto operator*(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator*(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         return this->Cross(rhs);
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        const auto [x, y, z] = Cross_internal(_base::underlyingData, UnderlyingDataFrom(other));
+    [[nodiscard]] constexpr auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        const auto [x, y, z] = Cross_internal<Scalar>(_base::underlyingData, UnderlyingDataFrom(other));
         return Vector<ThisSpace, UnderlyingData>(x, y, z);
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] double Dot(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        return implementation::Dot(_base::underlyingData, UnderlyingDataFrom(other));
+    [[nodiscard]] constexpr Scalar Dot(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        return implementation::Dot<Scalar>(_base::underlyingData, UnderlyingDataFrom(other));
     }
 
-    [[nodiscard]] auto ToXY() const requires ThisSpace::supportsXY
+    [[nodiscard]] constexpr auto ToXY() const requires ThisSpace::supportsXY
     {
         return XYVector<ThisSpace, UnderlyingData>(_base::X(), _base::Y());
     }
 
-    [[nodiscard]] auto Norm() const { return NormalizedVector<ThisSpace, UnderlyingData>(_base::X(), _base::Y(), _base::Z()); }
+    [[nodiscard]] constexpr auto Norm() const {
+        return NormalizedVector<ThisSpace, UnderlyingData>(_base::X(), _base::Y(), _base::Z());
+    }
+
+    [[nodiscard]] constexpr auto TryNorm() const noexcept {
+        return NormalizedVector<ThisSpace, UnderlyingData>::TryMake(_base::X(), _base::Y(), _base::Z());
+    }
 
     template <DifferentSpaceTo<ThisSpace> OtherSpace, typename TransformManager>
     [[nodiscard]] auto ConvertTo(const TransformManager& transform_manager) const noexcept {
@@ -104,7 +107,7 @@ class Vector final : public Base<ThisSpace, UnderlyingData, BaseType::Vector> {
 
     [[nodiscard]] auto Mag() const noexcept { return typename ThisSpace::Unit{Mag_double()}; }
 
-    [[nodiscard]] double Mag_double() const noexcept { return Mag_internal(_base::underlyingData); }
+    [[nodiscard]] constexpr double Mag_double() const noexcept { return Mag_internal<Scalar>(_base::underlyingData); }
 
     friend auto& operator<<(std::ostream& os, const Vector<ThisSpace, UnderlyingData>& v) { return os << std::format("{}", v); }
 
@@ -7,81 +7,74 @@ class XYPoint final : public Base<ThisSpace, UnderlyingData, BaseType::XYPoint>
     using _base = Base<ThisSpace, UnderlyingData, BaseType::XYPoint>;
 
   public:
-    XYPoint() noexcept { std::fill(_base::begin(), _base::end(), 0); }
-    explicit XYPoint(const UnderlyingData& v) noexcept {
-        auto iter = _base::begin();
-        auto in = implementation::CBegin(v);
-        *iter++ = *in++;
-        *iter++ = *in++;
-        *iter = 0;
-    }
-    XYPoint(const double x, const double y) noexcept {
-        auto iter = _base::begin();
-        *iter++ = x;
-        *iter++ = y;
-        *iter = 0;
-    }
-
-    [[nodiscard]] operator Point<ThisSpace, UnderlyingData>() const noexcept {
+    using Scalar = typename _base::Scalar;
+
+    constexpr XYPoint() noexcept { _base::Assign(0, 0, 0); }
+    constexpr explicit XYPoint(const UnderlyingData& v) noexcept {
+        _base::Assign(ComponentOf<Scalar>(v, 0), ComponentOf<Scalar>(v, 1), 0);
+    }
+    constexpr XYPoint(const Scalar x, const Scalar y) noexcept { _base::Assign(x, y, 0); }
+
+    [[nodiscard]] constexpr operator Point<ThisSpace, UnderlyingData>() const noexcept {
         return Point<ThisSpace, UnderlyingData>(_base::X(), _base::Y(), 0);
     }
 
     template <BaseType BT> requires(IsPoint(BT))
-    [[nodiscard]] bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        return std::equal(_base::cbegin(), _base::cend(), implementation::CBegin(UnderlyingDataFrom(other)), Equality);
+    [[nodiscard]] constexpr bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        return _base::EqualTo(UnderlyingDataFrom(other));
     }
 
     template <BaseType BT> requires(IsPoint(BT))
-    [[nodiscard]] bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+    [[nodiscard]] constexpr bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
         return !(operator==(other));
     }
 
     template <BaseType BT> requires(IsVector(BT) && IsXY(BT))
-    auto operator-=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
-        Sub(_base::underlyingData, UnderlyingDataFrom(rhs));
+    constexpr auto& operator-=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
+        Sub<Scalar>(_base::underlyingData, UnderlyingDataFrom(rhs));
         return *this;
     }
 
     template <BaseType BT> requires(IsVector(BT) && Is3D(BT))
-    [[nodiscard]] auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Point<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
     template <BaseType BT> requires(IsVector(BT) && IsXY(BT))
-    [[nodiscard]] auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         XYPoint<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
-    [[nodiscard]] auto operator-(const XYPoint<ThisSpace, UnderlyingData>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const XYPoint<ThisSpace, UnderlyingData>& rhs) const noexcept {
         XYVector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Sub(UnderlyingDataFrom(v), rhs._base::underlyingData);
+        Sub<Scalar>(UnderlyingDataFrom(v), rhs._base::underlyingData);
         return v;
     }
-    [[nodiscard]] auto operator-(const Point<ThisSpace, UnderlyingData>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Point<ThisSpace, UnderlyingData>& rhs) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT) && IsXY(BT))
-    auto operator+=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
-        Add(_base::underlyingData, UnderlyingDataFrom(rhs));
+    constexpr auto& operator+=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
+        Add<Scalar>(_base::underlyingData, UnderlyingDataFrom(rhs));
         return *this;
     }
 
     template <BaseType BT> requires(IsVector(BT) && Is3D(BT))
-    [[nodiscard]] auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Point<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Add(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Add<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
     template <BaseType BT> requires(IsVector(BT) && IsXY(BT))
-    [[nodiscard]] auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         XYPoint<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Add(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Add<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
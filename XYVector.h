@@ -8,102 +8,99 @@ class XYVector final : public Base<ThisSpace, UnderlyingData, BaseType::XYVector
     using _base = Base<ThisSpace, UnderlyingData, BaseType::XYVector>;
 
   public:
-    XYVector() noexcept { std::fill(_base::begin(), _base::end(), 0); }
-    explicit XYVector(const UnderlyingData& v) noexcept {
-        auto iter = _base::begin();
-        auto in = implementation::CBegin(v);
-        *iter++ = *in++;
-        *iter++ = *in++;
-        *iter = 0;
-    }
-    XYVector(const double x, const double y) noexcept {
-        auto iter = _base::begin();
-        *iter++ = x;
-        *iter++ = y;
-        *iter = 0;
-    }
-
-    [[nodiscard]] operator Vector<ThisSpace, UnderlyingData>() const noexcept {
+    using Scalar = typename _base::Scalar;
+
+    constexpr XYVector() noexcept { _base::Assign(0, 0, 0); }
+    constexpr explicit XYVector(const UnderlyingData& v) noexcept {
+        _base::Assign(ComponentOf<Scalar>(v, 0), ComponentOf<Scalar>(v, 1), 0);
+    }
+    constexpr XYVector(const Scalar x, const Scalar y) noexcept { _base::Assign(x, y, 0); }
+
+    [[nodiscard]] constexpr operator Vector<ThisSpace, UnderlyingData>() const noexcept {
         return Vector<ThisSpace, UnderlyingData>(_base::X(), _base::Y(), 0);
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        return std::equal(_base::cbegin(), _base::cend(), implementation::CBegin(UnderlyingDataFrom(other)), Equality);
+    [[nodiscard]] constexpr bool operator==(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        return _base::EqualTo(UnderlyingDataFrom(other));
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+    [[nodiscard]] constexpr bool operator!=(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
         return !(operator==(other));
     }
 
     template <BaseType BT> requires(IsVector(BT) && IsXY(BT))
-    auto operator-=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
-        Sub(_base::underlyingData, UnderlyingDataFrom(rhs));
+    constexpr auto& operator-=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
+        Sub<Scalar>(_base::underlyingData, UnderlyingDataFrom(rhs));
         return *this;
     }
 
     template <BaseType BT> requires(IsVector(BT) && Is3D(BT))
-    [[nodiscard]] auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
     template <BaseType BT> requires(IsVector(BT) && IsXY(BT))
-    [[nodiscard]] auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator-(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         XYVector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Sub(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Sub<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT) && IsXY(BT))
-    auto operator+=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
-        Add(_base::underlyingData, UnderlyingDataFrom(rhs));
+    constexpr auto& operator+=(const Base<ThisSpace, UnderlyingData, BT>& rhs) noexcept {
+        Add<Scalar>(_base::underlyingData, UnderlyingDataFrom(rhs));
         return *this;
     }
 
     template <BaseType BT> requires(IsVector(BT) && Is3D(BT))
-    [[nodiscard]] auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         Vector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Add(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Add<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT) && IsXY(BT))
-    [[nodiscard]] auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator+(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         XYVector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Add(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
+        Add<Scalar>(UnderlyingDataFrom(v), UnderlyingDataFrom(rhs));
         return v;
     }
 
-    auto operator*=(const double& d) noexcept {
-        Scale(_base::underlyingData, d);
+    constexpr auto& operator*=(const double& d) noexcept {
+        Scale<Scalar>(_base::underlyingData, d);
         return *this;
     }
 
-    [[nodiscard]] auto operator*(const double& d) const noexcept {
+    [[nodiscard]] constexpr auto operator*(const double& d) const noexcept {
         XYVector<ThisSpace, UnderlyingData> v(static_cast<UnderlyingData>(*this));
-        Scale(UnderlyingDataFrom(v), d);
+        Scale<Scalar>(UnderlyingDataFrom(v), d);
         return v;
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto operator*(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
+    [[nodiscard]] constexpr auto operator*(const Base<ThisSpace, UnderlyingData, BT>& rhs) const noexcept {
         return this->Cross(rhs);
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        const auto [x, y, z] = Cross_internal(_base::underlyingData, UnderlyingDataFrom(other));
+    [[nodiscard]] constexpr auto Cross(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        const auto [x, y, z] = Cross_internal<Scalar>(_base::underlyingData, UnderlyingDataFrom(other));
         return Vector<ThisSpace, UnderlyingData>(x, y, z);
     }
 
     template <BaseType BT> requires(IsVector(BT))
-    [[nodiscard]] double Dot(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
-        return implementation::Dot(_base::underlyingData, UnderlyingDataFrom(other));
+    [[nodiscard]] constexpr Scalar Dot(const Base<ThisSpace, UnderlyingData, BT>& other) const noexcept {
+        return implementation::Dot<Scalar>(_base::underlyingData, UnderlyingDataFrom(other));
     }
 
-    [[nodiscard]] auto Norm() const { return NormalizedXYVector<ThisSpace, UnderlyingData>(_base::X(), _base::Y()); }
+    [[nodiscard]] constexpr auto Norm() const { return NormalizedXYVector<ThisSpace, UnderlyingData>(_base::X(), _base::Y()); }
+
+    [[nodiscard]] constexpr auto TryNorm() const noexcept {
+        return NormalizedXYVector<ThisSpace, UnderlyingData>::TryMake(_base::X(), _base::Y());
+    }
 
     template <DifferentSpaceTo<ThisSpace> OtherSpace, typename TransformManager>
     [[nodiscard]] auto ConvertTo(const TransformManager& transform_manager) const noexcept {
@@ -114,7 +111,7 @@ class XYVector final : public Base<ThisSpace, UnderlyingData, BaseType::XYVector
 
     [[nodiscard]] auto Mag() const noexcept { return typename ThisSpace::Unit{Mag_double()}; }
 
-    [[nodiscard]] double Mag_double() const noexcept { return Mag_internal(_base::underlyingData); }
+    [[nodiscard]] constexpr double Mag_double() const noexcept { return Mag_internal<Scalar>(_base::underlyingData); }
 
     friend auto& operator<<(std::ostream& os, const XYVector<ThisSpace, UnderlyingData>& v) { return os << std::format("{}", v); }
 
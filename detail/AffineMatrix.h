@@ -0,0 +1,127 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// A 3x4 affine matrix. The values are stored column by column, with each
+/// column padded to four doubles so that it can be loaded as a single AVX
+/// register. The fourth column is the translation.
+struct AffineMatrix final {
+    alignas(32) std::array<double, 16> values{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0};
+
+    [[nodiscard]] double& operator()(const int row, const int column) noexcept { return values[column * 4 + row]; }
+    [[nodiscard]] double operator()(const int row, const int column) const noexcept { return values[column * 4 + row]; }
+
+    /// Returns the matrix which applies rhs first and then this one.
+    [[nodiscard]] AffineMatrix operator*(const AffineMatrix& rhs) const noexcept {
+        AffineMatrix m;
+        for (int row = 0; row < 3; ++row) {
+            for (int column = 0; column < 4; ++column) {
+                double d = column == 3 ? (*this)(row, 3) : 0.0;
+                for (int k = 0; k < 3; ++k) {
+                    d += (*this)(row, k) * rhs(k, column);
+                }
+                m(row, column) = d;
+            }
+        }
+        return m;
+    }
+
+    [[nodiscard]] AffineMatrix Inverse() const {
+        const auto& a = *this;
+        const double c00 = a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1);
+        const double c01 = a(1, 2) * a(2, 0) - a(1, 0) * a(2, 2);
+        const double c02 = a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0);
+        const double determinant = a(0, 0) * c00 + a(0, 1) * c01 + a(0, 2) * c02;
+        if (std::abs(determinant) < 1e-12) {
+            throw std::invalid_argument("The transform cannot be inverted");
+        }
+
+        AffineMatrix m;
+        m(0, 0) = c00 / determinant;
+        m(1, 0) = c01 / determinant;
+        m(2, 0) = c02 / determinant;
+        m(0, 1) = (a(0, 2) * a(2, 1) - a(0, 1) * a(2, 2)) / determinant;
+        m(1, 1) = (a(0, 0) * a(2, 2) - a(0, 2) * a(2, 0)) / determinant;
+        m(2, 1) = (a(0, 1) * a(2, 0) - a(0, 0) * a(2, 1)) / determinant;
+        m(0, 2) = (a(0, 1) * a(1, 2) - a(0, 2) * a(1, 1)) / determinant;
+        m(1, 2) = (a(0, 2) * a(1, 0) - a(0, 0) * a(1, 2)) / determinant;
+        m(2, 2) = (a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0)) / determinant;
+        for (int row = 0; row < 3; ++row) {
+            m(row, 3) = -(m(row, 0) * a(0, 3) + m(row, 1) * a(1, 3) + m(row, 2) * a(2, 3));
+        }
+        return m;
+    }
+
+    template <bool Translate, typename Scalar> void Apply(const Scalar* in, Scalar* out) const noexcept {
+        const double x = in[0];
+        const double y = in[1];
+        const double z = in[2];
+        for (int row = 0; row < 3; ++row) {
+            const double t = Translate ? (*this)(row, 3) : 0.0;
+            out[row] = static_cast<Scalar>((*this)(row, 0) * x + (*this)(row, 1) * y + (*this)(row, 2) * z + t);
+        }
+    }
+};
+
+/// Applies the matrix to count elements, each of which starts with three
+/// scalars and is strideBytes from the previous one. The input and output may
+/// be the same. The matrix is always held in double precision; only elements
+/// of doubles take the AVX paths.
+template <bool Translate, typename Scalar>
+static void ApplyAffine(
+    const AffineMatrix& m,
+    const Scalar* in,
+    Scalar* out,
+    const std::size_t count,
+    const std::size_t strideBytes
+) noexcept {
+    const auto element = [strideBytes]<typename T>(T* first, const std::size_t i) {
+        using byte = std::conditional_t<std::is_const_v<T>, const std::byte, std::byte>;
+        return reinterpret_cast<T*>(reinterpret_cast<byte*>(first) + i * strideBytes);
+    };
+
+    std::size_t i = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+    if constexpr (std::is_same_v<Scalar, double>) {
+        const __m256i mask = _mm256_setr_epi64x(-1, -1, -1, 0);
+        const __m256d c0 = _mm256_load_pd(&m.values[0]);
+        const __m256d c1 = _mm256_load_pd(&m.values[4]);
+        const __m256d c2 = _mm256_load_pd(&m.values[8]);
+        const __m256d t = Translate ? _mm256_load_pd(&m.values[12]) : _mm256_setzero_pd();
+
+#if defined(__AVX512F__)
+        // Two elements per iteration, one in each half of the register.
+        const __m512d c0x2 = _mm512_broadcast_f64x4(c0);
+        const __m512d c1x2 = _mm512_broadcast_f64x4(c1);
+        const __m512d c2x2 = _mm512_broadcast_f64x4(c2);
+        const __m512d tx2 = _mm512_broadcast_f64x4(t);
+        const auto broadcast = [](const double* a, const double* b) {
+            return _mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_broadcast_sd(a)), _mm256_broadcast_sd(b), 1);
+        };
+        for (; i + 2 <= count; i += 2) {
+            const double* a = element(in, i);
+            const double* b = element(in, i + 1);
+            __m512d r = _mm512_fmadd_pd(c0x2, broadcast(a, b), tx2);
+            r = _mm512_fmadd_pd(c1x2, broadcast(a + 1, b + 1), r);
+            r = _mm512_fmadd_pd(c2x2, broadcast(a + 2, b + 2), r);
+            _mm256_maskstore_pd(element(out, i), mask, _mm512_castpd512_pd256(r));
+            _mm256_maskstore_pd(element(out, i + 1), mask, _mm512_extractf64x4_pd(r, 1));
+        }
+#endif
+
+        for (; i < count; ++i) {
+            const double* a = element(in, i);
+            __m256d r = _mm256_fmadd_pd(c0, _mm256_broadcast_sd(a), t);
+            r = _mm256_fmadd_pd(c1, _mm256_broadcast_sd(a + 1), r);
+            r = _mm256_fmadd_pd(c2, _mm256_broadcast_sd(a + 2), r);
+            _mm256_maskstore_pd(element(out, i), mask, r);
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        m.Apply<Translate>(element(in, i), element(out, i));
+    }
+}
+
+} // namespace Space::implementation
@@ -40,68 +40,79 @@ static consteval auto Name(BaseType BT) {
     }
 }
 
+/// The type of each coordinate in a space. Spaces store doubles unless they
+/// choose another scalar type through SpaceBase.
+template <typename S> struct ScalarOfSpace {
+    using type = double;
+};
+template <typename S> requires requires { typename S::Scalar; }
+struct ScalarOfSpace<S> {
+    using type = typename S::Scalar;
+};
+template <typename S> using ScalarOf = typename ScalarOfSpace<S>::type;
+
 template <typename ThisSpace, typename UnderlyingData, BaseType BT> class Base {
 
   public:
-    [[nodiscard]] explicit operator UnderlyingData() const noexcept { return underlyingData; }
-    [[nodiscard]] const double* cbegin() const noexcept { return reinterpret_cast<const double*>(&underlyingData); }
-    [[nodiscard]] const double* cend() const noexcept {
-        return reinterpret_cast<const double*>(&underlyingData) + Dimensions(BT);
-    }
+    using Scalar = ScalarOf<ThisSpace>;
 
-    [[nodiscard]] double* begin() noexcept requires(IsNotNormalized(BT))
+    [[nodiscard]] constexpr explicit operator UnderlyingData() const noexcept { return underlyingData; }
+    [[nodiscard]] const Scalar* cbegin() const noexcept { return CBegin<Scalar>(underlyingData); }
+    [[nodiscard]] const Scalar* cend() const noexcept { return CBegin<Scalar>(underlyingData) + Dimensions(BT); }
+
+    [[nodiscard]] Scalar* begin() noexcept requires(IsNotNormalized(BT))
     {
-        return reinterpret_cast<double*>(&underlyingData);
+        return Begin<Scalar>(underlyingData);
     }
-    [[nodiscard]] double* end() noexcept requires(IsNotNormalized(BT))
+    [[nodiscard]] Scalar* end() noexcept requires(IsNotNormalized(BT))
     {
-        return reinterpret_cast<double*>(&underlyingData) + Dimensions(BT);
+        return Begin<Scalar>(underlyingData) + Dimensions(BT);
     }
 
-    [[nodiscard]] double X() const noexcept { return *(cbegin() + 0); }
-    [[nodiscard]] double Y() const noexcept { return *(cbegin() + 1); }
-    [[nodiscard]] double Z() const noexcept requires(Is3D(BT))
+    [[nodiscard]] constexpr Scalar X() const noexcept { return ComponentOf<Scalar>(underlyingData, 0); }
+    [[nodiscard]] constexpr Scalar Y() const noexcept { return ComponentOf<Scalar>(underlyingData, 1); }
+    [[nodiscard]] constexpr Scalar Z() const noexcept requires(Is3D(BT))
     {
-        return *(cbegin() + 2);
+        return ComponentOf<Scalar>(underlyingData, 2);
     }
 
-    void SetX(const double d) noexcept requires(IsNotNormalized(BT))
+    constexpr void SetX(const Scalar d) noexcept requires(IsNotNormalized(BT))
     {
-        *(begin() + 0) = d;
+        SetComponent<Scalar>(underlyingData, 0, d);
     }
-    void SetY(const double d) noexcept requires(IsNotNormalized(BT))
+    constexpr void SetY(const Scalar d) noexcept requires(IsNotNormalized(BT))
     {
-        *(begin() + 1) = d;
+        SetComponent<Scalar>(underlyingData, 1, d);
     }
 
-    void SetZ(const double d) noexcept requires(IsNotNormalized(BT) && Is3D(BT))
+    constexpr void SetZ(const Scalar d) noexcept requires(IsNotNormalized(BT) && Is3D(BT))
     {
-        *(begin() + 2) = d;
+        SetComponent<Scalar>(underlyingData, 2, d);
     }
 
-    [[nodiscard]] double operator[](const unsigned int i) const {
+    [[nodiscard]] constexpr Scalar operator[](const unsigned int i) const {
         if (i >= Dimensions(BT)) {
             throw std::invalid_argument("Index is out of range");
         }
-        return *(cbegin() + i);
+        return ComponentOf<Scalar>(underlyingData, i);
     }
 
-    [[nodiscard]] double& operator[](const unsigned int i) requires(IsNotNormalized(BT))
+    [[nodiscard]] Scalar& operator[](const unsigned int i) requires(IsNotNormalized(BT))
     {
         if (i >= Dimensions(BT)) {
             throw std::invalid_argument("Index is out of range");
         }
-        return *(reinterpret_cast<double*>(&underlyingData) + i);
+        return *(Begin<Scalar>(underlyingData) + i);
     }
 
     template <int I> requires(ValidForDimensions(I, Dimensions(BT)))
-    [[nodiscard]] double at() const {
-        return operator[](I);
+    [[nodiscard]] constexpr Scalar at() const noexcept {
+        return ComponentOf<Scalar>(underlyingData, I);
     }
 
     template <int I> requires(ValidForDimensions(I, Dimensions(BT)) && IsNotNormalized(BT))
-    [[nodiscard]] double& at() {
-        return operator[](I);
+    [[nodiscard]] Scalar& at() noexcept {
+        return *(Begin<Scalar>(underlyingData) + I);
     }
 
 #ifndef IGNORE_SPACE_STATIC_ASSERT
@@ -116,20 +127,20 @@ template <typename ThisSpace, typename UnderlyingData, BaseType BT> class Base {
         return StaticAssert::invalid_3D_access{};
     }
 
-    StaticAssert::invalid_3D_access SetZ(const double d) noexcept requires(IsNotNormalized(BT) && IsXY(BT))
+    StaticAssert::invalid_3D_access SetZ(const Scalar d) noexcept requires(IsNotNormalized(BT) && IsXY(BT))
     {
         return StaticAssert::invalid_3D_access{};
     }
 
-    StaticAssert::invalid_normalized_vector_modification SetX(const double d) noexcept requires(IsNormalized(BT))
+    StaticAssert::invalid_normalized_vector_modification SetX(const Scalar d) noexcept requires(IsNormalized(BT))
     {
         return StaticAssert::invalid_normalized_vector_modification{};
     }
-    StaticAssert::invalid_normalized_vector_modification SetY(const double d) noexcept requires(IsNormalized(BT))
+    StaticAssert::invalid_normalized_vector_modification SetY(const Scalar d) noexcept requires(IsNormalized(BT))
     {
         return StaticAssert::invalid_normalized_vector_modification{};
     }
-    StaticAssert::invalid_normalized_vector_modification SetZ(const double d) noexcept requires(IsNormalized(BT))
+    StaticAssert::invalid_normalized_vector_modification SetZ(const Scalar d) noexcept requires(IsNormalized(BT))
     {
         return StaticAssert::invalid_normalized_vector_modification{};
     }
@@ -193,24 +204,47 @@ template <typename ThisSpace, typename UnderlyingData, BaseType BT> class Base {
 #endif
 
   protected:
-    template <typename S, typename U, BaseType B> friend const U& UnderlyingDataFrom(const Base<S, U, B>& a);
+    template <typename S, typename U, BaseType B> friend constexpr const U& UnderlyingDataFrom(const Base<S, U, B>& a);
+
+    template <typename S, typename U, BaseType B> friend constexpr U& UnderlyingDataFrom(Base<S, U, B>& a);
+
+    /// Sets the first three values of the underlying data, leaving anything
+    /// after them untouched.
+    constexpr void Assign(const Scalar x, const Scalar y, const Scalar z) noexcept {
+        SetComponent<Scalar>(underlyingData, 0, x);
+        SetComponent<Scalar>(underlyingData, 1, y);
+        SetComponent<Scalar>(underlyingData, 2, z);
+    }
 
-    template <typename S, typename U, BaseType B> friend U& UnderlyingDataFrom(Base<S, U, B>& a);
+    [[nodiscard]] constexpr bool EqualTo(const UnderlyingData& other) const noexcept {
+        for (int i = 0; i < Dimensions(BT); ++i) {
+            if (!Equality(ComponentOf<Scalar>(underlyingData, i), ComponentOf<Scalar>(other, i))) {
+                return false;
+            }
+        }
+        return true;
+    }
 
-    UnderlyingData underlyingData;
+    /// Value-initialized so that points and vectors can be constant expressions.
+    UnderlyingData underlyingData{};
 };
 
-template <typename S, typename U, BaseType B> const U& UnderlyingDataFrom(const Base<S, U, B>& a) { return a.underlyingData; }
+template <typename S, typename U, BaseType B> constexpr const U& UnderlyingDataFrom(const Base<S, U, B>& a) {
+    return a.underlyingData;
+}
 
-template <typename S, typename U, BaseType B> U& UnderlyingDataFrom(Base<S, U, B>& a) { return a.underlyingData; }
+template <typename S, typename U, BaseType B> constexpr U& UnderlyingDataFrom(Base<S, U, B>& a) { return a.underlyingData; }
 
 template <typename S, BaseType BT> struct baseFormatter : std::formatter<std::string> {
 
-    std::formatter<double> doubleFormatter;
-    std::formatter<std::string> stringFormatter;
+    std::formatter<ScalarOf<S>> scalarFormatter;
+    std::formatter<std::string_view> stringFormatter;
 
     constexpr auto parse(std::format_parse_context& ctx) {
         auto it = ctx.begin();
+        if (it == ctx.end()) {
+            return it;
+        }
 
         switch (*it) {
         case 's':
@@ -226,25 +260,25 @@ template <typename S, BaseType BT> struct baseFormatter : std::formatter<std::st
         case 'x':
             _format_type = format_type::x_only;
             ctx.advance_to(it + 1);
-            it = doubleFormatter.parse(ctx);
+            it = scalarFormatter.parse(ctx);
             break;
         case 'y':
             _format_type = format_type::y_only;
             ctx.advance_to(it + 1);
-            it = doubleFormatter.parse(ctx);
+            it = scalarFormatter.parse(ctx);
             break;
         case 'z':
             if (Is3D(BT)) {
                 _format_type = format_type::z_only;
                 ctx.advance_to(it + 1);
-                it = doubleFormatter.parse(ctx);
+                it = scalarFormatter.parse(ctx);
                 break;
             } else {
                 throw std::format_error("Z is not supported by this type");
             }
         default:
             _format_type = format_type::full;
-            it = stringFormatter.parse(ctx);
+            it = ParseFull(ctx);
             break;
         }
 
@@ -254,37 +288,28 @@ template <typename S, BaseType BT> struct baseFormatter : std::formatter<std::st
     template <class FormatContext> auto format(const auto& v, FormatContext& fc) const {
         switch (_format_type) {
         case format_type::type_only:
-            fc.advance_to(stringFormatter.format(Name(BT), fc));
+            fc.advance_to(stringFormatter.format(std::string_view(Name(BT)), fc));
             return fc.out();
         case format_type::space_only:
-            fc.advance_to(stringFormatter.format(Space::SpaceTypeNameMap<S>::name, fc));
+            fc.advance_to(stringFormatter.format(std::string_view(Space::SpaceTypeNameMap<S>::name), fc));
             return fc.out();
         case format_type::x_only:
-            fc.advance_to(doubleFormatter.format(v.X(), fc));
+            fc.advance_to(scalarFormatter.format(v.X(), fc));
             return fc.out();
         case format_type::y_only:
-            fc.advance_to(doubleFormatter.format(v.Y(), fc));
+            fc.advance_to(scalarFormatter.format(v.Y(), fc));
             return fc.out();
         case format_type::z_only:
             if constexpr (Is3D(BT)) {
-                fc.advance_to(doubleFormatter.format(v.Z(), fc));
+                fc.advance_to(scalarFormatter.format(v.Z(), fc));
                 return fc.out();
             }
             throw std::format_error("Invalid format type");
         case format_type::full:
             if constexpr (Is3D(BT)) {
-                fc.advance_to(stringFormatter.format(
-                    std::format(
-                        fc.locale(), "{}::{} ({:L}, {:L}, {:L})", Space::SpaceTypeNameMap<S>::name, Name(BT), v.X(), v.Y(), v.Z()
-                    ),
-                    fc
-                ));
-                return fc.out();
+                return FormatFull(fc, Space::SpaceTypeNameMap<S>::name, Name(BT), v.X(), v.Y(), v.Z());
             } else {
-                fc.advance_to(stringFormatter.format(
-                    std::format(fc.locale(), "{}::{} ({:L}, {:L})", Space::SpaceTypeNameMap<S>::name, Name(BT), v.X(), v.Y()), fc
-                ));
-                return fc.out();
+                return FormatFull(fc, Space::SpaceTypeNameMap<S>::name, Name(BT), v.X(), v.Y());
             }
         default:
             throw std::format_error("Invalid format type");
@@ -294,6 +319,63 @@ template <typename S, BaseType BT> struct baseFormatter : std::formatter<std::st
   private:
     enum class format_type { full, space_only, type_only, x_only, y_only, z_only };
     format_type _format_type = format_type::full;
+
+    // The full format is written straight to the output rather than through
+    // a temporary string, so its fill, alignment, width and L are kept here.
+    char fill = ' ';
+    char align = '<';
+    std::size_t width = 0;
+    bool localized = false;
+
+    constexpr auto ParseFull(std::format_parse_context& ctx) {
+        auto it = ctx.begin();
+        const auto end = ctx.end();
+        // A plain {} leaves the context at its closing brace, which is not a fill
+        // character even when the format string goes on with an alignment character.
+        if (it == end || *it == '}') {
+            return it;
+        }
+        const auto isAlign = [](const char c) { return c == '<' || c == '^' || c == '>'; };
+        if (it + 1 != end && isAlign(*(it + 1))) {
+            if (*it == '{' || *it == '}') {
+                throw std::format_error("Braces cannot be used as a fill character");
+            }
+            fill = *it;
+            align = *(it + 1);
+            it += 2;
+        } else if (isAlign(*it)) {
+            align = *it++;
+        }
+        while (it != end && *it >= '0' && *it <= '9') {
+            width = width * 10 + static_cast<std::size_t>(*it++ - '0');
+        }
+        if (it != end && *it == 'L') {
+            localized = true;
+            ++it;
+        }
+        if (it != end && *it != '}') {
+            throw std::format_error("Invalid format for a point or vector");
+        }
+        return it;
+    }
+
+    /// The locale is only used when L is given, and the output is only measured
+    /// when a width is given.
+    template <class FormatContext, typename... Values> auto FormatFull(FormatContext& fc, const Values&... values) const {
+        constexpr std::string_view plain = Is3D(BT) ? "{}::{} ({}, {}, {})" : "{}::{} ({}, {})";
+        constexpr std::string_view local = Is3D(BT) ? "{}::{} ({:L}, {:L}, {:L})" : "{}::{} ({:L}, {:L})";
+
+        std::size_t size = 0;
+        if (width > 0) {
+            size = localized ? std::formatted_size(fc.locale(), local, values...) : std::formatted_size(plain, values...);
+        }
+        const std::size_t padding = width > size ? width - size : 0;
+        const std::size_t before = align == '>' ? padding : align == '^' ? padding / 2 : 0;
+
+        auto out = std::fill_n(fc.out(), before, fill);
+        out = localized ? std::format_to(out, fc.locale(), local, values...) : std::format_to(out, plain, values...);
+        return std::fill_n(out, padding - before, fill);
+    }
 };
 
 } // namespace Space::implementation
@@ -0,0 +1,59 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// A TransformManager can optionally convert whole ranges in one call by
+/// providing TransformPoints and TransformVectors, which read from the first
+/// span and write to the second. Managers without them are called per element.
+template <typename TransformManager, typename From, typename To, typename UnderlyingData>
+concept BatchPointTransformer =
+    requires(const TransformManager& tm, std::span<const UnderlyingData> in, std::span<UnderlyingData> out) {
+        tm.template TransformPoints<From, To>(in, out);
+    };
+
+template <typename TransformManager, typename From, typename To, typename UnderlyingData>
+concept BatchVectorTransformer =
+    requires(const TransformManager& tm, std::span<const UnderlyingData> in, std::span<UnderlyingData> out) {
+        tm.template TransformVectors<From, To>(in, out);
+    };
+
+template <typename From, typename To, typename UnderlyingData, typename TransformManager>
+static void TransformPoints(
+    const TransformManager& transform_manager,
+    std::span<const UnderlyingData> in,
+    std::span<UnderlyingData> out
+) {
+    if constexpr (BatchPointTransformer<TransformManager, From, To, UnderlyingData>) {
+        transform_manager.template TransformPoints<From, To>(in, out);
+    } else {
+        std::transform(in.begin(), in.end(), out.begin(), [&transform_manager](const UnderlyingData& u) {
+            return transform_manager.template TransformPoint<From, To>(u);
+        });
+    }
+}
+
+template <typename From, typename To, typename UnderlyingData, typename TransformManager>
+static void TransformVectors(
+    const TransformManager& transform_manager,
+    std::span<const UnderlyingData> in,
+    std::span<UnderlyingData> out
+) {
+    if constexpr (BatchVectorTransformer<TransformManager, From, To, UnderlyingData>) {
+        transform_manager.template TransformVectors<From, To>(in, out);
+    } else {
+        std::transform(in.begin(), in.end(), out.begin(), [&transform_manager](const UnderlyingData& u) {
+            return transform_manager.template TransformVector<From, To>(u);
+        });
+    }
+}
+
+template <typename From, typename To, BaseType BT, typename UnderlyingData, typename TransformManager>
+static void Transform(const TransformManager& transform_manager, std::span<const UnderlyingData> in, std::span<UnderlyingData> out) {
+    if constexpr (IsPoint(BT)) {
+        TransformPoints<From, To>(transform_manager, in, out);
+    } else {
+        TransformVectors<From, To>(transform_manager, in, out);
+    }
+}
+
+} // namespace Space::implementation
@@ -2,58 +2,127 @@
 
 namespace Space::implementation {
 
-template <typename UnderlyingData> [[nodiscard]] static double* Begin(UnderlyingData& i) noexcept {
-    return reinterpret_cast<double*>(&i);
+/// Vectors with a magnitude below this cannot be normalized.
+inline constexpr double normalizationTolerance = 1e-6;
+
+template <typename Scalar, typename UnderlyingData>
+using AccessOf = UnderlyingDataAccess<std::remove_const_t<UnderlyingData>, Scalar>;
+
+// The helpers below view UnderlyingData as three values of the space's scalar
+// type, which is double unless the space chooses otherwise, laid out as its
+// UnderlyingDataAccess describes.
+template <typename Scalar = double, typename UnderlyingData> [[nodiscard]] static Scalar* Begin(UnderlyingData& i) noexcept {
+    return AccessOf<Scalar, UnderlyingData>::Data(i);
+}
+template <typename Scalar = double, typename UnderlyingData>
+[[nodiscard]] static const Scalar* CBegin(const UnderlyingData& i) noexcept {
+    return AccessOf<Scalar, UnderlyingData>::Data(i);
+}
+template <typename Scalar = double, typename UnderlyingData>
+[[nodiscard]] static const Scalar* CEnd(const UnderlyingData& i) noexcept {
+    return AccessOf<Scalar, UnderlyingData>::Data(i) + 3;
+}
+
+template <typename Scalar = double, typename UnderlyingData>
+[[nodiscard]] static constexpr Scalar ComponentOf(const UnderlyingData& u, const std::size_t i) noexcept {
+    return AccessOf<Scalar, UnderlyingData>::Get(u, i);
 }
-template <typename UnderlyingData> [[nodiscard]] static const double* CBegin(const UnderlyingData& i) noexcept {
-    return reinterpret_cast<const double*>(&i);
+
+template <typename Scalar = double, typename UnderlyingData>
+static constexpr void SetComponent(UnderlyingData& u, const std::size_t i, const Scalar value) noexcept {
+    AccessOf<Scalar, UnderlyingData>::Set(u, i, value);
 }
-template <typename UnderlyingData> [[nodiscard]] static const double* CEnd(const UnderlyingData& i) noexcept {
-    return reinterpret_cast<const double*>(&i) + 3;
+
+/// std::sqrt is not usable in constant expressions until C++26, so constant
+/// evaluation uses Newton's method instead.
+template <typename Scalar> [[nodiscard]] static constexpr Scalar SquareRoot(const Scalar v) noexcept {
+    if consteval {
+        if (!(v > 0) || v == std::numeric_limits<Scalar>::infinity()) {
+            return v == 0 || v > 0 ? v : std::numeric_limits<Scalar>::quiet_NaN();
+        }
+        Scalar x = v > 1 ? v : Scalar{1};
+        while (true) {
+            const Scalar next = (x + v / x) / 2;
+            if (next >= x) {
+                return x;
+            }
+            x = next;
+        }
+    }
+    return std::sqrt(v);
 }
 
-template <typename UnderlyingData> static void Add(UnderlyingData& self, const UnderlyingData& other) {
-    std::transform(CBegin(self), CEnd(self), CBegin(other), Begin(self), std::plus<>());
+// These are written out per component, rather than with algorithms over the
+// three values, so that they compile to the same code as hand-written maths.
+// Reading other before writing self lets the compiler assume no overlap.
+template <typename Scalar = double, typename UnderlyingData>
+static constexpr void Add(UnderlyingData& self, const UnderlyingData& other) noexcept {
+    const Scalar x = ComponentOf<Scalar>(other, 0);
+    const Scalar y = ComponentOf<Scalar>(other, 1);
+    const Scalar z = ComponentOf<Scalar>(other, 2);
+    SetComponent<Scalar>(self, 0, ComponentOf<Scalar>(self, 0) + x);
+    SetComponent<Scalar>(self, 1, ComponentOf<Scalar>(self, 1) + y);
+    SetComponent<Scalar>(self, 2, ComponentOf<Scalar>(self, 2) + z);
 }
 
-template <typename UnderlyingData> static void Sub(UnderlyingData& self, const UnderlyingData& other) {
-    std::transform(CBegin(self), CEnd(self), CBegin(other), Begin(self), std::minus<>());
+template <typename Scalar = double, typename UnderlyingData>
+static constexpr void Sub(UnderlyingData& self, const UnderlyingData& other) noexcept {
+    const Scalar x = ComponentOf<Scalar>(other, 0);
+    const Scalar y = ComponentOf<Scalar>(other, 1);
+    const Scalar z = ComponentOf<Scalar>(other, 2);
+    SetComponent<Scalar>(self, 0, ComponentOf<Scalar>(self, 0) - x);
+    SetComponent<Scalar>(self, 1, ComponentOf<Scalar>(self, 1) - y);
+    SetComponent<Scalar>(self, 2, ComponentOf<Scalar>(self, 2) - z);
 }
 
-template <typename UnderlyingData> static void Scale(UnderlyingData& self, const double& d) {
-    std::transform(CBegin(self), CEnd(self), Begin(self), [d](auto v) { return v * d; });
+template <typename Scalar = double, typename UnderlyingData>
+static constexpr void Scale(UnderlyingData& self, const double& d) noexcept {
+    SetComponent<Scalar>(self, 0, static_cast<Scalar>(ComponentOf<Scalar>(self, 0) * d));
+    SetComponent<Scalar>(self, 1, static_cast<Scalar>(ComponentOf<Scalar>(self, 1) * d));
+    SetComponent<Scalar>(self, 2, static_cast<Scalar>(ComponentOf<Scalar>(self, 2) * d));
 }
 
-template <typename UnderlyingData> static double Dot(const UnderlyingData& A, const UnderlyingData& B) noexcept {
-    return std::transform_reduce(
-        CBegin(A), CEnd(A), CBegin(B), 0.0, [](auto accumulation, auto v) { return accumulation + v; },
-        [](auto v1, auto v2) { return v1 * v2; }
-    );
+template <typename Scalar = double, typename UnderlyingData>
+static constexpr Scalar Dot(const UnderlyingData& A, const UnderlyingData& B) noexcept {
+    return ComponentOf<Scalar>(A, 0) * ComponentOf<Scalar>(B, 0) + ComponentOf<Scalar>(A, 1) * ComponentOf<Scalar>(B, 1) +
+           ComponentOf<Scalar>(A, 2) * ComponentOf<Scalar>(B, 2);
 }
 
-template <typename UnderlyingData> static auto Cross_internal(const UnderlyingData& A, const UnderlyingData& B) noexcept {
+template <typename Scalar = double, typename UnderlyingData>
+static constexpr auto Cross_internal(const UnderlyingData& A, const UnderlyingData& B) noexcept {
 
-    const double ax = *(CBegin(A) + 0);
-    const double ay = *(CBegin(A) + 1);
-    const double az = *(CBegin(A) + 2);
+    const Scalar ax = ComponentOf<Scalar>(A, 0);
+    const Scalar ay = ComponentOf<Scalar>(A, 1);
+    const Scalar az = ComponentOf<Scalar>(A, 2);
 
-    const double bx = *(CBegin(B) + 0);
-    const double by = *(CBegin(B) + 1);
-    const double bz = *(CBegin(B) + 2);
+    const Scalar bx = ComponentOf<Scalar>(B, 0);
+    const Scalar by = ComponentOf<Scalar>(B, 1);
+    const Scalar bz = ComponentOf<Scalar>(B, 2);
 
-    const double x = ay * bz - az * by;
-    const double y = az * bx - ax * bz;
-    const double z = ax * by - ay * bx;
+    const Scalar x = ay * bz - az * by;
+    const Scalar y = az * bx - ax * bz;
+    const Scalar z = ax * by - ay * bx;
 
     return std::tuple{x, y, z};
 }
 
-template <typename UnderlyingData> [[nodiscard]] static double Mag_internal(const UnderlyingData& i) noexcept {
+template <typename Scalar = double, typename UnderlyingData>
+[[nodiscard]] static constexpr Scalar Mag_internal(const UnderlyingData& i) noexcept {
+    return SquareRoot(Dot<Scalar>(i, i));
+}
 
-    return std::sqrt(std::accumulate(CBegin(i), CEnd(i), 0.0, [](const auto accumulation, const auto v) {
-        return accumulation + v * v;
-    }));
+/// The value of a quantity in a space's units, which are either a number or a
+/// strong type with get(), such as Named Type.
+template <typename Unit> [[nodiscard]] static constexpr double ValueOfUnit(const Unit& u) noexcept {
+    if constexpr (std::is_arithmetic_v<Unit>) {
+        return static_cast<double>(u);
+    } else {
+        return static_cast<double>(u.get());
+    }
 }
 
-[[nodiscard]] static bool Equality(const double& x, const double& y) { return std::abs(x - y) < 1e-6; }
+[[nodiscard]] static constexpr bool Equality(const double& x, const double& y) {
+    const double difference = x - y;
+    return difference < 1e-6 && -difference < 1e-6;
+}
 } // namespace Space::implementation
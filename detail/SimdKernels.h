@@ -0,0 +1,245 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// The widest native pack of a scalar type. std::simd is used when the
+/// standard library provides it, then the Parallelism TS version, and
+/// otherwise the kernels fall back to one value at a time. A pack of floats
+/// holds twice as many values as a pack of doubles.
+#if defined(__cpp_lib_simd)
+template <typename Scalar> using ScalarPack = std::simd<Scalar>;
+#elif defined(__cpp_lib_experimental_parallel_simd)
+template <typename Scalar> using ScalarPack = std::experimental::native_simd<Scalar>;
+#else
+template <typename Scalar> using ScalarPack = Scalar;
+#endif
+
+template <typename T> inline constexpr std::size_t packWidth = 1;
+template <typename T> requires(!std::is_arithmetic_v<T>)
+inline constexpr std::size_t packWidth<T> = T::size();
+
+/// Loads component c of the elements starting at element i, where each
+/// element is stride values from the previous one. Consecutive values are
+/// copied as a block; otherwise, and for std::simd, each lane is gathered.
+template <typename T, typename Scalar>
+[[nodiscard]] static T Load(const Scalar* p, const std::size_t i, const std::size_t stride, const std::size_t c) noexcept {
+    if constexpr (std::is_same_v<T, Scalar>) {
+        return p[i * stride + c];
+    } else {
+#if !defined(__cpp_lib_simd)
+        if (stride == 1) {
+            T v;
+            v.copy_from(p + i + c, std::experimental::element_aligned);
+            return v;
+        }
+#endif
+        return T([=](const auto lane) { return p[(i + lane) * stride + c]; });
+    }
+}
+
+template <typename T, typename Scalar>
+static void Store(const T& v, Scalar* p, const std::size_t i, const std::size_t stride, const std::size_t c) noexcept {
+    if constexpr (std::is_same_v<T, Scalar>) {
+        p[i * stride + c] = v;
+    } else {
+#if !defined(__cpp_lib_simd)
+        if (stride == 1) {
+            v.copy_to(p + i + c, std::experimental::element_aligned);
+            return;
+        }
+#endif
+        for (std::size_t lane = 0; lane < packWidth<T>; ++lane) {
+            p[(i + lane) * stride + c] = v[lane];
+        }
+    }
+}
+
+/// Calls body with a full pack for as many elements as possible, and then
+/// with single values for the remainder.
+template <typename Scalar, typename Body> static void Vectorized(const std::size_t count, Body&& body) {
+    using Pack = ScalarPack<Scalar>;
+    constexpr std::size_t width = packWidth<Pack>;
+    std::size_t i = 0;
+    for (; i + width <= count; i += width) {
+        body.template operator()<Pack>(i);
+    }
+    for (; i < count; ++i) {
+        body.template operator()<Scalar>(i);
+    }
+}
+
+/// Applies op to every component of count elements. When the elements are
+/// exactly three values, they are treated as one flat array.
+template <typename Scalar, typename Op>
+static void ComponentwiseKernel(
+    const Scalar* a,
+    const Scalar* b,
+    Scalar* out,
+    const std::size_t count,
+    const std::size_t stride,
+    Op op
+) {
+    if (stride == 3) {
+        Vectorized<Scalar>(count * 3, [&]<typename T>(const std::size_t i) {
+            Store(op(Load<T>(a, i, 1, 0), Load<T>(b, i, 1, 0)), out, i, 1, 0);
+        });
+        return;
+    }
+    Vectorized<Scalar>(count, [&]<typename T>(const std::size_t i) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            Store(op(Load<T>(a, i, stride, c), Load<T>(b, i, stride, c)), out, i, stride, c);
+        }
+    });
+}
+
+template <typename Scalar, typename Op>
+static void ComponentwiseKernel(const Scalar* a, Scalar* out, const std::size_t count, const std::size_t stride, Op op) {
+    if (stride == 3) {
+        Vectorized<Scalar>(count * 3, [&]<typename T>(const std::size_t i) { Store(op(Load<T>(a, i, 1, 0)), out, i, 1, 0); });
+        return;
+    }
+    Vectorized<Scalar>(count, [&]<typename T>(const std::size_t i) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            Store(op(Load<T>(a, i, stride, c)), out, i, stride, c);
+        }
+    });
+}
+
+template <typename Scalar>
+static void DotKernel(const Scalar* a, const Scalar* b, Scalar* out, const std::size_t count, const std::size_t stride) {
+    Vectorized<Scalar>(count, [&]<typename T>(const std::size_t i) {
+        const T x = Load<T>(a, i, stride, 0) * Load<T>(b, i, stride, 0);
+        const T y = Load<T>(a, i, stride, 1) * Load<T>(b, i, stride, 1);
+        const T z = Load<T>(a, i, stride, 2) * Load<T>(b, i, stride, 2);
+        Store<T>(x + y + z, out, i, 1, 0);
+    });
+}
+
+template <typename Scalar>
+static void CrossKernel(const Scalar* a, const Scalar* b, Scalar* out, const std::size_t count, const std::size_t stride) {
+    Vectorized<Scalar>(count, [&]<typename T>(const std::size_t i) {
+        const T ax = Load<T>(a, i, stride, 0);
+        const T ay = Load<T>(a, i, stride, 1);
+        const T az = Load<T>(a, i, stride, 2);
+        const T bx = Load<T>(b, i, stride, 0);
+        const T by = Load<T>(b, i, stride, 1);
+        const T bz = Load<T>(b, i, stride, 2);
+        Store<T>(ay * bz - az * by, out, i, stride, 0);
+        Store<T>(az * bx - ax * bz, out, i, stride, 1);
+        Store<T>(ax * by - ay * bx, out, i, stride, 2);
+    });
+}
+
+template <typename Scalar> static void MagKernel(const Scalar* a, Scalar* out, const std::size_t count, const std::size_t stride) {
+    Vectorized<Scalar>(count, [&]<typename T>(const std::size_t i) {
+        using std::sqrt;
+        const T x = Load<T>(a, i, stride, 0);
+        const T y = Load<T>(a, i, stride, 1);
+        const T z = Load<T>(a, i, stride, 2);
+        Store<T>(sqrt(x * x + y * y + z * z), out, i, 1, 0);
+    });
+}
+
+/// Lowers lo and raises hi to the smallest and largest of each of the first
+/// dimensions components of count elements.
+template <typename Scalar>
+static void MinMaxKernel(
+    const Scalar* p,
+    const std::size_t count,
+    const std::size_t stride,
+    const std::size_t dimensions,
+    Scalar* lo,
+    Scalar* hi
+) {
+    using std::max;
+    using std::min;
+    using Pack = ScalarPack<Scalar>;
+    constexpr std::size_t width = packWidth<Pack>;
+    for (std::size_t c = 0; c < dimensions; ++c) {
+        std::size_t i = 0;
+        if constexpr (width > 1) {
+            Pack packLo(lo[c]);
+            Pack packHi(hi[c]);
+            for (; i + width <= count; i += width) {
+                const Pack v = Load<Pack>(p, i, stride, c);
+                packLo = min(packLo, v);
+                packHi = max(packHi, v);
+            }
+            for (std::size_t lane = 0; lane < width; ++lane) {
+                lo[c] = min<Scalar>(lo[c], packLo[lane]);
+                hi[c] = max<Scalar>(hi[c], packHi[lane]);
+            }
+        }
+        for (; i < count; ++i) {
+            lo[c] = min(lo[c], p[i * stride + c]);
+            hi[c] = max(hi[c], p[i * stride + c]);
+        }
+    }
+}
+
+/// Spreads the low bits of v apart so that each is followed by gaps zero
+/// bits, ready to be interleaved with the bits of other coordinates.
+template <std::size_t gaps> [[nodiscard]] static constexpr std::uint64_t SpreadBits(std::uint64_t v) noexcept {
+    if constexpr (gaps == 1) {
+#if defined(__BMI2__)
+        if !consteval {
+            return _pdep_u64(v, 0x5555555555555555ULL);
+        }
+#endif
+        v &= 0xFFFFFFFFULL;
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFULL;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFULL;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        v = (v | (v << 2)) & 0x3333333333333333ULL;
+        return (v | (v << 1)) & 0x5555555555555555ULL;
+    } else {
+        static_assert(gaps == 2, "Morton codes interleave two or three coordinates.");
+#if defined(__BMI2__)
+        if !consteval {
+            return _pdep_u64(v, 0x1249249249249249ULL);
+        }
+#endif
+        v &= 0x1FFFFFULL;
+        v = (v | (v << 32)) & 0x001F00000000FFFFULL;
+        v = (v | (v << 16)) & 0x001F0000FF0000FFULL;
+        v = (v | (v << 8)) & 0x100F00F00F00F00FULL;
+        v = (v | (v << 4)) & 0x10C30C30C30C30C3ULL;
+        return (v | (v << 2)) & 0x1249249249249249ULL;
+    }
+}
+
+/// Writes the Morton code of each of count elements to out. Each coordinate c
+/// is scaled to (p - lo[c]) * scale[c] a pack at a time, and then clamped to
+/// the cells of one axis, 2^32 of them for two dimensions or 2^21 for three,
+/// before the bits of the coordinates are interleaved with X lowest.
+template <typename Scalar, std::size_t dimensions>
+static void MortonKernel(
+    const Scalar* p,
+    const std::size_t count,
+    const std::size_t stride,
+    const Scalar* lo,
+    const Scalar* scale,
+    std::uint64_t* out
+) {
+    constexpr double cells = dimensions == 2 ? 4294967296.0 : 2097152.0;
+    Vectorized<Scalar>(count, [&]<typename T>(const std::size_t i) {
+        std::array<std::uint64_t, packWidth<T>> codes{};
+        for (std::size_t c = 0; c < dimensions; ++c) {
+            const T scaled = (Load<T>(p, i, stride, c) - T(lo[c])) * T(scale[c]);
+            for (std::size_t lane = 0; lane < packWidth<T>; ++lane) {
+                double v;
+                if constexpr (std::is_same_v<T, Scalar>) {
+                    v = static_cast<double>(scaled);
+                } else {
+                    v = static_cast<double>(scaled[lane]);
+                }
+                // Points outside the box, and coordinates which are not numbers, go in the nearest cell.
+                const std::uint64_t cell = v >= 0 ? static_cast<std::uint64_t>(std::min(v, cells - 1)) : 0;
+                codes[lane] |= SpreadBits<dimensions - 1>(cell) << c;
+            }
+        }
+        std::copy(codes.begin(), codes.end(), out + i);
+    });
+}
+
+} // namespace Space::implementation
@@ -122,6 +122,49 @@ struct invalid_normalized_vector_modification final {
     }
 };
 
+struct invalid_transform_composition final {
+    template <typename T = void> invalid_transform_composition() {
+        static_assert(false, "You can only compose a transform with one that starts in the space where it ends.");
+    }
+};
+
+struct no_transform_route final {
+    template <typename T = void> no_transform_route() {
+        static_assert(false, "There is no route between these spaces in the transform graph.");
+    }
+};
+
+struct invalid_transform_edge final {
+    template <typename T = void> invalid_transform_edge() {
+        static_assert(false, "You can only set a transform which is an edge of the transform graph.");
+    }
+};
+
+struct invalid_precision_conversion final {
+    template <typename T = void> invalid_precision_conversion() {
+        static_assert(
+            false, "You can only change precision between a space and its PrecisionVariant, "
+                   "which must have the same units and XY support."
+        );
+    }
+};
+
+struct invalid_bounds_dimensions final {
+    template <typename T = void> invalid_bounds_dimensions() {
+        static_assert(false, "A bounding box can only hold points with the same number of dimensions as the box.");
+    }
+};
+
+struct invalid_vector_bounds final {
+    template <typename T = void> invalid_vector_bounds() { static_assert(false, "You can only find the bounds of points."); }
+};
+
+struct invalid_spatial_query final {
+    template <typename T = void> invalid_spatial_query() {
+        static_assert(false, "A spatial index can only be searched with the type of point that it holds.");
+    }
+};
+
 struct XYVector_not_supported final {
     template <typename T = void> XYVector_not_supported() {
         static_assert(false, "This space does not support 2D vectors or points.");
@@ -0,0 +1,33 @@
+#pragma once
+
+namespace Space::implementation {
+
+/// Below this many elements for each thread, starting a thread costs more
+/// than it saves.
+inline constexpr std::size_t minimumPerThread = std::size_t{1} << 16;
+
+/// The number of threads worth using for count elements: one for each
+/// minimumPerThread elements, but no more than there are cores, and at least one.
+[[nodiscard]] static std::size_t ThreadsFor(const std::size_t count) noexcept {
+    const std::size_t cores = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    return std::clamp<std::size_t>(count / minimumPerThread, 1, cores);
+}
+
+/// Splits count elements into threads parts of nearly the same size, and runs
+/// body(t, first, last) for part t on threads - 1 new threads and this one.
+/// Returns once every part has finished.
+template <typename Body> static void OnThreads(const std::size_t threads, const std::size_t count, Body&& body) {
+    const std::size_t perThread = (count + threads - 1) / threads;
+    const auto part = [&](const std::size_t t) {
+        const std::size_t first = std::min(count, t * perThread);
+        body(t, first, std::min(count, first + perThread));
+    };
+    std::vector<std::jthread> workers;
+    workers.reserve(threads - 1);
+    for (std::size_t t = 0; t + 1 < threads; ++t) {
+        workers.emplace_back(part, t);
+    }
+    part(threads - 1);
+}
+
+} // namespace Space::implementation